@@ -0,0 +1,205 @@
+// Generated by tools/pack_assets.py from web/ - do not edit
+#include "memutils.h"
+#include "modules/assets.h"
+
+// /app.js
+static const uint8_t a0_head[] = "HTTP/1.1 200 OK\r\nContent-Type: text/javascript; charset=utf-8\r\nContent-Length: 270\r\nVary: Accept-Encoding\r\nETag: \"ccf4f398df31f470\"\r\nCache-Control: no-cache\r\n";
+static const uint8_t a0_304[] = "HTTP/1.1 304 Not Modified\r\nVary: Accept-Encoding\r\nETag: \"ccf4f398df31f470\"\r\nCache-Control: no-cache\r\n";
+static const uint8_t a0_body[] = {
+	0x22, 0x75, 0x73, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x63, 0x74, 0x22, 0x3b, 0x0a, 0x0a, 0x28,
+	0x61, 0x73, 0x79, 0x6e, 0x63, 0x20, 0x28, 0x29, 0x20, 0x3d, 0x3e, 0x20, 0x7b, 0x0a, 0x09, 0x63,
+	0x6f, 0x6e, 0x73, 0x74, 0x20, 0x65, 0x6c, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65,
+	0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49,
+	0x64, 0x28, 0x22, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x22, 0x29, 0x3b, 0x0a, 0x09, 0x74, 0x72,
+	0x79, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x20,
+	0x3d, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x22, 0x2f,
+	0x68, 0x65, 0x61, 0x6c, 0x74, 0x68, 0x22, 0x2c, 0x20, 0x7b, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65,
+	0x3a, 0x20, 0x22, 0x6e, 0x6f, 0x2d, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x22, 0x20, 0x7d, 0x29, 0x3b,
+	0x0a, 0x09, 0x09, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x62, 0x6f, 0x64, 0x79, 0x20, 0x3d, 0x20,
+	0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x72, 0x65, 0x73, 0x2e, 0x6a, 0x73, 0x6f, 0x6e, 0x28, 0x29,
+	0x3b, 0x0a, 0x09, 0x09, 0x65, 0x6c, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65,
+	0x6e, 0x74, 0x20, 0x3d, 0x20, 0x62, 0x6f, 0x64, 0x79, 0x2e, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73,
+	0x3b, 0x0a, 0x09, 0x7d, 0x20, 0x63, 0x61, 0x74, 0x63, 0x68, 0x20, 0x28, 0x65, 0x72, 0x72, 0x29,
+	0x20, 0x7b, 0x0a, 0x09, 0x09, 0x65, 0x6c, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74,
+	0x65, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x22, 0x75, 0x6e, 0x72, 0x65, 0x61, 0x63, 0x68, 0x61, 0x62,
+	0x6c, 0x65, 0x22, 0x3b, 0x0a, 0x09, 0x7d, 0x0a, 0x7d, 0x29, 0x28, 0x29, 0x3b, 0x0a,
+};
+static const uint8_t a0_gz_head[] = "HTTP/1.1 200 OK\r\nContent-Type: text/javascript; charset=utf-8\r\nContent-Length: 199\r\nContent-Encoding: gzip\r\nVary: Accept-Encoding\r\nETag: \"a288519db1f449cb\"\r\nCache-Control: no-cache\r\n";
+static const uint8_t a0_gz_304[] = "HTTP/1.1 304 Not Modified\r\nVary: Accept-Encoding\r\nETag: \"a288519db1f449cb\"\r\nCache-Control: no-cache\r\n";
+static const uint8_t a0_gz_body[] = {
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x65, 0x8e, 0x31, 0x0e, 0xc2, 0x30,
+	0x0c, 0x45, 0x67, 0x72, 0x0a, 0xcb, 0x53, 0x2a, 0x41, 0xd9, 0xa9, 0xca, 0x00, 0x62, 0xe0, 0x18,
+	0x69, 0x6a, 0x68, 0x51, 0x48, 0xa4, 0xd8, 0x15, 0x54, 0x55, 0xef, 0x4e, 0x52, 0x2a, 0x16, 0x36,
+	0x4b, 0xfe, 0xef, 0xfd, 0x8f, 0x03, 0x13, 0xb0, 0xc4, 0xde, 0x0a, 0x56, 0x4a, 0x69, 0xc3, 0xa3,
+	0xb7, 0xa0, 0x0b, 0xa8, 0x8f, 0x30, 0xa9, 0x8d, 0x0d, 0x9e, 0x05, 0xc8, 0x41, 0x0d, 0x6d, 0xb0,
+	0xc3, 0x93, 0xbc, 0x94, 0x77, 0x92, 0x8b, 0xa3, 0x7c, 0x9e, 0xc6, 0x6b, 0xab, 0x91, 0xc5, 0xc8,
+	0xc0, 0x58, 0x54, 0x6a, 0x23, 0x71, 0xcc, 0xd4, 0x8a, 0x45, 0xe2, 0xc4, 0x99, 0x97, 0xe9, 0x05,
+	0x6e, 0x24, 0xb6, 0xd3, 0xb8, 0xef, 0xc8, 0x38, 0xe9, 0x70, 0x0b, 0x13, 0x58, 0x63, 0x3b, 0x3a,
+	0x00, 0xfa, 0xb0, 0x63, 0x09, 0x91, 0x10, 0xe6, 0xec, 0x58, 0xe1, 0x26, 0xb4, 0xe3, 0x8f, 0x4e,
+	0xa6, 0xf2, 0xc1, 0xc1, 0xeb, 0x25, 0x40, 0xae, 0x14, 0x7a, 0xcb, 0x39, 0x78, 0x49, 0x23, 0x52,
+	0x28, 0x67, 0xcb, 0xef, 0x8c, 0xf4, 0x9f, 0x93, 0x39, 0x95, 0x81, 0xa6, 0x18, 0x8b, 0x65, 0xce,
+	0x1f, 0x80, 0x83, 0x8f, 0x94, 0xea, 0x4d, 0xe3, 0x08, 0x33, 0xa2, 0xe6, 0x22, 0xbb, 0x3f, 0xa3,
+	0x3a, 0x0d, 0x5a, 0x0e, 0x01, 0x00, 0x00,
+};
+
+// /index.html
+static const uint8_t a1_head[] = "HTTP/1.1 200 OK\r\nContent-Type: text/html; charset=utf-8\r\nContent-Length: 452\r\nVary: Accept-Encoding\r\nETag: \"3178531ccc7dc840\"\r\nCache-Control: no-cache\r\n";
+static const uint8_t a1_304[] = "HTTP/1.1 304 Not Modified\r\nVary: Accept-Encoding\r\nETag: \"3178531ccc7dc840\"\r\nCache-Control: no-cache\r\n";
+static const uint8_t a1_body[] = {
+	0x3c, 0x21, 0x64, 0x6f, 0x63, 0x74, 0x79, 0x70, 0x65, 0x20, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a,
+	0x3c, 0x68, 0x74, 0x6d, 0x6c, 0x20, 0x6c, 0x61, 0x6e, 0x67, 0x3d, 0x22, 0x65, 0x6e, 0x22, 0x3e,
+	0x0a, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x0a, 0x09, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x63,
+	0x68, 0x61, 0x72, 0x73, 0x65, 0x74, 0x3d, 0x22, 0x75, 0x74, 0x66, 0x2d, 0x38, 0x22, 0x3e, 0x0a,
+	0x09, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x76, 0x69, 0x65,
+	0x77, 0x70, 0x6f, 0x72, 0x74, 0x22, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x22,
+	0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2d, 0x77, 0x69, 0x64,
+	0x74, 0x68, 0x2c, 0x20, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x2d, 0x73, 0x63, 0x61, 0x6c,
+	0x65, 0x3d, 0x31, 0x22, 0x3e, 0x0a, 0x09, 0x3c, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x6e, 0x52,
+	0x46, 0x35, 0x32, 0x38, 0x34, 0x30, 0x20, 0x77, 0x65, 0x62, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65,
+	0x72, 0x3c, 0x2f, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x0a, 0x09, 0x3c, 0x6c, 0x69, 0x6e, 0x6b,
+	0x20, 0x72, 0x65, 0x6c, 0x3d, 0x22, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x68, 0x65, 0x65, 0x74,
+	0x22, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x2f, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x63,
+	0x73, 0x73, 0x22, 0x3e, 0x0a, 0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x0a, 0x3c, 0x62, 0x6f,
+	0x64, 0x79, 0x3e, 0x0a, 0x09, 0x3c, 0x6d, 0x61, 0x69, 0x6e, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x68,
+	0x31, 0x3e, 0x6e, 0x52, 0x46, 0x35, 0x32, 0x38, 0x34, 0x30, 0x20, 0x77, 0x65, 0x62, 0x20, 0x73,
+	0x65, 0x72, 0x76, 0x65, 0x72, 0x3c, 0x2f, 0x68, 0x31, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x70, 0x3e,
+	0x53, 0x65, 0x72, 0x76, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x66, 0x6c, 0x61, 0x73,
+	0x68, 0x20, 0x62, 0x79, 0x20, 0x61, 0x6e, 0x20, 0x6e, 0x52, 0x46, 0x35, 0x32, 0x38, 0x34, 0x30,
+	0x20, 0x61, 0x6e, 0x64, 0x20, 0x61, 0x20, 0x57, 0x35, 0x35, 0x30, 0x30, 0x2c, 0x20, 0x72, 0x75,
+	0x6e, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x46, 0x72, 0x65, 0x65, 0x52, 0x54, 0x4f, 0x53, 0x2e, 0x3c,
+	0x2f, 0x70, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x70, 0x3e, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x3a,
+	0x20, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x73, 0x74, 0x61, 0x74, 0x75,
+	0x73, 0x22, 0x3e, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x69, 0x6e, 0x67, 0x2e, 0x2e, 0x2e, 0x3c, 0x2f,
+	0x73, 0x70, 0x61, 0x6e, 0x3e, 0x3c, 0x2f, 0x70, 0x3e, 0x0a, 0x09, 0x3c, 0x2f, 0x6d, 0x61, 0x69,
+	0x6e, 0x3e, 0x0a, 0x09, 0x3c, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3d,
+	0x22, 0x2f, 0x61, 0x70, 0x70, 0x2e, 0x6a, 0x73, 0x22, 0x3e, 0x3c, 0x2f, 0x73, 0x63, 0x72, 0x69,
+	0x70, 0x74, 0x3e, 0x0a, 0x3c, 0x2f, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x0a, 0x3c, 0x2f, 0x68, 0x74,
+	0x6d, 0x6c, 0x3e, 0x0a,
+};
+static const uint8_t a1_gz_head[] = "HTTP/1.1 200 OK\r\nContent-Type: text/html; charset=utf-8\r\nContent-Length: 304\r\nContent-Encoding: gzip\r\nVary: Accept-Encoding\r\nETag: \"97e0032b2f7f40bb\"\r\nCache-Control: no-cache\r\n";
+static const uint8_t a1_gz_304[] = "HTTP/1.1 304 Not Modified\r\nVary: Accept-Encoding\r\nETag: \"97e0032b2f7f40bb\"\r\nCache-Control: no-cache\r\n";
+static const uint8_t a1_gz_body[] = {
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x6d, 0x91, 0x41, 0x6f, 0xc2, 0x30,
+	0x0c, 0x85, 0xcf, 0xf0, 0x2b, 0xbc, 0x9c, 0xa1, 0x85, 0x69, 0x48, 0x68, 0x4a, 0x7b, 0xe4, 0x3a,
+	0x09, 0x26, 0xed, 0x1c, 0x12, 0x97, 0x64, 0xa4, 0x6e, 0x94, 0x18, 0x50, 0xff, 0xfd, 0x92, 0x76,
+	0xe3, 0xb4, 0x93, 0x95, 0xcf, 0xef, 0xd9, 0xcf, 0x8a, 0x7c, 0x31, 0x83, 0xe6, 0x31, 0x20, 0x58,
+	0xee, 0x7d, 0xbb, 0x94, 0xa5, 0x80, 0x57, 0x74, 0x69, 0x04, 0x92, 0x28, 0x00, 0x95, 0x69, 0x97,
+	0x0b, 0xd9, 0x23, 0x2b, 0xd0, 0x56, 0xc5, 0x84, 0xdc, 0x88, 0x1b, 0x77, 0xeb, 0xbd, 0x78, 0x72,
+	0x52, 0x3d, 0x36, 0xe2, 0xee, 0xf0, 0x11, 0x86, 0xc8, 0x02, 0xf4, 0x40, 0x8c, 0x94, 0x75, 0x0f,
+	0x67, 0xd8, 0x36, 0x06, 0xef, 0x4e, 0xe3, 0x7a, 0x7a, 0xac, 0xc0, 0x91, 0x63, 0xa7, 0xfc, 0x3a,
+	0x69, 0xe5, 0xb1, 0xd9, 0x4e, 0x53, 0xd8, 0xb1, 0xc7, 0x96, 0x8e, 0x87, 0xdd, 0xeb, 0xfe, 0x6d,
+	0x03, 0x0f, 0x3c, 0x43, 0xc2, 0x78, 0xc7, 0x28, 0xeb, 0xb9, 0x95, 0x35, 0xde, 0xd1, 0x15, 0x22,
+	0xfa, 0x46, 0x24, 0x1e, 0x3d, 0x26, 0x8b, 0x98, 0x57, 0xd9, 0x88, 0x5d, 0x23, 0xea, 0x09, 0x55,
+	0x3a, 0xa5, 0x92, 0xb9, 0x9e, 0x43, 0xcb, 0xf3, 0x60, 0xc6, 0x29, 0xa3, 0x72, 0x94, 0xeb, 0x42,
+	0xda, 0xed, 0xff, 0x3b, 0x32, 0x2f, 0xed, 0xd0, 0x9e, 0x0a, 0x30, 0xd0, 0xc5, 0xa1, 0x87, 0xce,
+	0xab, 0x64, 0xe1, 0x3c, 0x82, 0x22, 0x78, 0xba, 0x14, 0x19, 0x50, 0xf0, 0xb5, 0xdb, 0x6d, 0x36,
+	0x2b, 0x88, 0x37, 0x22, 0x47, 0x17, 0x38, 0x44, 0xc4, 0xe3, 0xe7, 0xc7, 0xa9, 0x92, 0x75, 0xf8,
+	0x1b, 0xc4, 0x8a, 0x6f, 0xe9, 0x1d, 0x64, 0x0a, 0xd9, 0xee, 0x4c, 0x09, 0x5d, 0x88, 0x68, 0xb5,
+	0x45, 0x7d, 0xcd, 0xae, 0xaa, 0xca, 0xf2, 0xd2, 0x6d, 0x67, 0x97, 0xac, 0x7f, 0x63, 0xca, 0xa4,
+	0xa3, 0x0b, 0x0c, 0x29, 0xea, 0x7c, 0x98, 0x0a, 0xa1, 0xfa, 0xce, 0xb6, 0xac, 0x9d, 0x70, 0x39,
+	0x6f, 0xbe, 0x2b, 0xc7, 0x9e, 0xfe, 0xec, 0x07, 0x28, 0xa2, 0x94, 0x34, 0xc4, 0x01, 0x00, 0x00,
+};
+
+// /style.css
+static const uint8_t a2_head[] = "HTTP/1.1 200 OK\r\nContent-Type: text/css; charset=utf-8\r\nContent-Length: 360\r\nVary: Accept-Encoding\r\nETag: \"3740275f09f86ee3\"\r\nCache-Control: no-cache\r\n";
+static const uint8_t a2_304[] = "HTTP/1.1 304 Not Modified\r\nVary: Accept-Encoding\r\nETag: \"3740275f09f86ee3\"\r\nCache-Control: no-cache\r\n";
+static const uint8_t a2_body[] = {
+	0x62, 0x6f, 0x64, 0x79, 0x20, 0x7b, 0x0a, 0x09, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20,
+	0x30, 0x3b, 0x0a, 0x09, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a,
+	0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x2d, 0x75, 0x69, 0x2c, 0x20, 0x2d, 0x61, 0x70, 0x70,
+	0x6c, 0x65, 0x2d, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x2c, 0x20, 0x22, 0x53, 0x65, 0x67, 0x6f,
+	0x65, 0x20, 0x55, 0x49, 0x22, 0x2c, 0x20, 0x52, 0x6f, 0x62, 0x6f, 0x74, 0x6f, 0x2c, 0x20, 0x73,
+	0x61, 0x6e, 0x73, 0x2d, 0x73, 0x65, 0x72, 0x69, 0x66, 0x3b, 0x0a, 0x09, 0x62, 0x61, 0x63, 0x6b,
+	0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x20, 0x23, 0x66, 0x34, 0x66, 0x35, 0x66, 0x37, 0x3b,
+	0x0a, 0x09, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x31, 0x64, 0x31, 0x66, 0x32, 0x33,
+	0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x6d, 0x61, 0x69, 0x6e, 0x20, 0x7b, 0x0a, 0x09, 0x6d, 0x61, 0x78,
+	0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x34, 0x30, 0x72, 0x65, 0x6d, 0x3b, 0x0a, 0x09,
+	0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x34, 0x72, 0x65, 0x6d, 0x20, 0x61, 0x75, 0x74,
+	0x6f, 0x3b, 0x0a, 0x09, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x32, 0x72, 0x65,
+	0x6d, 0x3b, 0x0a, 0x09, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x20,
+	0x23, 0x66, 0x66, 0x66, 0x3b, 0x0a, 0x09, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61,
+	0x64, 0x69, 0x75, 0x73, 0x3a, 0x20, 0x30, 0x2e, 0x35, 0x72, 0x65, 0x6d, 0x3b, 0x0a, 0x09, 0x62,
+	0x6f, 0x78, 0x2d, 0x73, 0x68, 0x61, 0x64, 0x6f, 0x77, 0x3a, 0x20, 0x30, 0x20, 0x31, 0x70, 0x78,
+	0x20, 0x33, 0x70, 0x78, 0x20, 0x72, 0x67, 0x62, 0x61, 0x28, 0x30, 0x2c, 0x20, 0x30, 0x2c, 0x20,
+	0x30, 0x2c, 0x20, 0x30, 0x2e, 0x31, 0x32, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x68, 0x31, 0x20,
+	0x7b, 0x0a, 0x09, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x74, 0x6f, 0x70, 0x3a, 0x20, 0x30,
+	0x3b, 0x0a, 0x09, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20, 0x31, 0x2e,
+	0x36, 0x72, 0x65, 0x6d, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x23, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73,
+	0x20, 0x7b, 0x0a, 0x09, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a,
+	0x20, 0x36, 0x30, 0x30, 0x3b, 0x0a, 0x7d, 0x0a,
+};
+static const uint8_t a2_gz_head[] = "HTTP/1.1 200 OK\r\nContent-Type: text/css; charset=utf-8\r\nContent-Length: 262\r\nContent-Encoding: gzip\r\nVary: Accept-Encoding\r\nETag: \"0faebf3658ac9d95\"\r\nCache-Control: no-cache\r\n";
+static const uint8_t a2_gz_304[] = "HTTP/1.1 304 Not Modified\r\nVary: Accept-Encoding\r\nETag: \"0faebf3658ac9d95\"\r\nCache-Control: no-cache\r\n";
+static const uint8_t a2_gz_body[] = {
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x55, 0x90, 0x4d, 0x6e, 0x83, 0x30,
+	0x10, 0x85, 0xd7, 0xe1, 0x14, 0xa3, 0x64, 0xd3, 0x4a, 0x18, 0x61, 0xf2, 0x53, 0xc9, 0x9c, 0xa0,
+	0xdb, 0x56, 0x3d, 0xc0, 0x10, 0xff, 0x60, 0x15, 0x3c, 0xc8, 0x36, 0x02, 0x5a, 0xf5, 0xee, 0x75,
+	0x20, 0x52, 0x5a, 0xc9, 0xb3, 0xf0, 0x37, 0xcf, 0x6f, 0x9e, 0xa7, 0x21, 0xb9, 0xc0, 0x77, 0xb6,
+	0xeb, 0xd1, 0x1b, 0xeb, 0x04, 0x94, 0x75, 0xb6, 0xd3, 0xe4, 0x22, 0xd3, 0xd8, 0xdb, 0x6e, 0x11,
+	0x10, 0x96, 0x10, 0x55, 0xcf, 0x46, 0x9b, 0x03, 0xc3, 0x61, 0xe8, 0x14, 0xdb, 0x48, 0x0e, 0xfb,
+	0x77, 0x65, 0x48, 0xc1, 0xc7, 0xeb, 0x3e, 0x87, 0x37, 0x6a, 0x28, 0x52, 0x0e, 0x01, 0x5d, 0x60,
+	0x41, 0x79, 0xab, 0x93, 0x4f, 0x83, 0xd7, 0x4f, 0xe3, 0x69, 0x74, 0x52, 0xc0, 0x41, 0x9f, 0xf4,
+	0x59, 0xbf, 0x24, 0x7a, 0xa5, 0x8e, 0x7c, 0x02, 0x5c, 0x72, 0x5d, 0x1d, 0xeb, 0xec, 0x27, 0xcb,
+	0x7a, 0xb4, 0x6e, 0x0b, 0x31, 0xb3, 0xc9, 0xca, 0xd8, 0x0a, 0x38, 0x95, 0x5e, 0xf5, 0xf5, 0x23,
+	0xd7, 0x29, 0x5d, 0x01, 0xc7, 0x48, 0x89, 0x0d, 0x28, 0xa5, 0x75, 0x46, 0x40, 0xb5, 0x69, 0xfe,
+	0xcf, 0xd1, 0xeb, 0x68, 0xf2, 0x52, 0x79, 0xe6, 0x51, 0xda, 0x31, 0xa4, 0x5f, 0x15, 0xe7, 0xbb,
+	0x94, 0x66, 0x16, 0x5a, 0x94, 0x34, 0x25, 0x08, 0x7c, 0x98, 0xe1, 0x98, 0xca, 0x9b, 0x06, 0x9f,
+	0xca, 0x1c, 0xee, 0xa7, 0xe0, 0xd5, 0xf3, 0x9a, 0xab, 0xe5, 0x8f, 0xd5, 0xb0, 0x48, 0xc3, 0x9f,
+	0xf5, 0x04, 0xfb, 0xa5, 0x04, 0xf0, 0xe2, 0xb2, 0xfa, 0x26, 0xed, 0x21, 0x44, 0x8c, 0x63, 0xb8,
+	0x3d, 0x58, 0x05, 0x93, 0xb2, 0xa6, 0x8d, 0x02, 0x2e, 0x65, 0x79, 0xeb, 0xff, 0x02, 0x4a, 0x1b,
+	0x5e, 0xc9, 0x68, 0x01, 0x00, 0x00,
+};
+
+static const asset_t assets[3] = {
+	// /app.js
+	{{a0_head, sizeof(a0_head) - 1, a0_body, 270u,
+		a0_304, sizeof(a0_304) - 1, "\"ccf4f398df31f470\"", 18},
+		{a0_gz_head, sizeof(a0_gz_head) - 1, a0_gz_body, 199u,
+		a0_gz_304, sizeof(a0_gz_304) - 1, "\"a288519db1f449cb\"", 18}},
+	// /index.html
+	{{a1_head, sizeof(a1_head) - 1, a1_body, 452u,
+		a1_304, sizeof(a1_304) - 1, "\"3178531ccc7dc840\"", 18},
+		{a1_gz_head, sizeof(a1_gz_head) - 1, a1_gz_body, 304u,
+		a1_gz_304, sizeof(a1_gz_304) - 1, "\"97e0032b2f7f40bb\"", 18}},
+	// /style.css
+	{{a2_head, sizeof(a2_head) - 1, a2_body, 360u,
+		a2_304, sizeof(a2_304) - 1, "\"3740275f09f86ee3\"", 18},
+		{a2_gz_head, sizeof(a2_gz_head) - 1, a2_gz_body, 262u,
+		a2_gz_304, sizeof(a2_gz_304) - 1, "\"0faebf3658ac9d95\"", 18}},
+};
+
+static const struct {
+	const char* path;
+	uint8_t path_len;
+	uint8_t asset;
+} asset_keys[4] = {
+	{"/app.js", 7, 0},
+	{"/index.html", 11, 1},
+	{"/", 1, 1},
+	{"/style.css", 10, 2},
+};
+
+#define ASSET_SLOTS 8u
+
+// slot -> index into asset_keys, 0xFF = empty
+static const uint8_t asset_slots[ASSET_SLOTS] = {1, 0xFF, 0xFF, 2, 0xFF, 3, 0xFF, 0};
+
+static uint32_t asset_hash(const uint8_t* key, uint16_t len) {
+	uint32_t h = 2166136261u ^ 3u;
+	for (uint16_t i = 0; i < len; i++) {
+		h ^= key[i];
+		h *= 16777619u;
+	}
+	return h;
+}
+
+const asset_t* assets_find(const uint8_t* path, uint16_t len) {
+	uint8_t idx = asset_slots[asset_hash(path, len) & (ASSET_SLOTS - 1u)];
+	if (idx == 0xFF)
+		return NULL;
+
+	if (asset_keys[idx].path_len != len || mem_cmp(asset_keys[idx].path, path, len) != 0)
+		return NULL;
+
+	return &assets[asset_keys[idx].asset];
+}
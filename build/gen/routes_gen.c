@@ -0,0 +1,53 @@
+// Generated by tools/gen_routes.py from src/modules/routes.tbl - do not edit
+#include "memutils.h"
+#include "modules/http_routes.h"
+
+int route_health(const http_req_t* req, const uint8_t* buf, http_resp_t* resp);
+int route_static(const http_req_t* req, const uint8_t* buf, http_resp_t* resp);
+int route_stats(const http_req_t* req, const uint8_t* buf, http_resp_t* resp);
+
+#define ROUTE_SLOTS 2u
+
+static const http_route_t exact_routes[2] = {
+	{"/health", 7, 0, {route_health, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/stats", 6, 0, {route_stats, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+};
+
+// slot -> index into exact_routes, 0xFF = empty
+static const uint8_t route_slots[ROUTE_SLOTS] = {0, 1};
+
+#define PREFIX_COUNT 1u
+
+// longest first
+static const http_route_t prefix_routes[PREFIX_COUNT] = {
+	{"/", 1, 1, {route_static, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+};
+
+static uint32_t route_hash(const uint8_t* key, uint16_t len) {
+	uint32_t h = 2166136261u ^ 0u;
+	for (uint16_t i = 0; i < len; i++) {
+		h ^= key[i];
+		h *= 16777619u;
+	}
+	return h;
+}
+
+const http_route_t* http_route_find(const uint8_t* path, uint16_t len) {
+	uint8_t idx = route_slots[route_hash(path, len) & (ROUTE_SLOTS - 1u)];
+	if (idx != 0xFF) {
+		const http_route_t* r = &exact_routes[idx];
+		if (r->path_len == len && mem_cmp(r->path, path, len) == 0)
+			return r;
+	}
+
+	for (uint8_t i = 0; i < PREFIX_COUNT; i++) {
+		const http_route_t* r = &prefix_routes[i];
+		if (r->path_len <= len && mem_cmp(r->path, path, r->path_len) == 0)
+			return r;
+	}
+
+	return NULL;
+}
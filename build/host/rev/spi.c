@@ -0,0 +1,733 @@
+#include "drivers/spi.h"
+#include "FreeRTOS.h"
+#include "board.h"
+#include "memutils.h"
+#include "modules/logger.h"
+#include "semphr.h"
+
+// from linker script
+extern uint8_t __ram_start__;
+extern uint8_t __ram_end__;
+
+#define SPIM_MAXCNT_MAX 0xFFFFu // TXD/RXD.MAXCNT are 16 bit on nRF52840
+
+// Transaction engine flags
+#define XFER_SESSION (1u << 0) // issued between spi_begin/spi_end: CS and config already set
+
+#define ABORT_NONE 0
+#define ABORT_STOPPING 1 // ISR does not chain while the task stops SPIM
+#define ABORT_FINISH 2	 // ISR completes cur with -1
+
+// Everything one SPIM instance needs. The engine part is owned by the instance's IRQ handler
+// and touched by tasks only inside critical sections.
+typedef struct {
+	NRF_SPIM_Type* regs;
+	IRQn_Type irqn;
+	uint8_t fast; // SPIM3 only: 16/32 MHz and high drive pins
+
+	uint8_t scratch_buf[SPI_SCRATCH_SIZE];
+	uint8_t tx_staging_buf[SPI_SCRATCH_SIZE]; // only used if input tx buf is not in RAM
+
+	SemaphoreHandle_t bus_mutex; // mutex for exclusive access to the SPI bus
+	StaticSemaphore_t bus_mutex_buf;
+	const spi_device_t* active_dev; // device currently active on the bus
+
+	SemaphoreHandle_t xfer_done; // given when a blocking (session) transfer completes
+	StaticSemaphore_t xfer_done_buf;
+	SemaphoreHandle_t claim_done; // given when the engine hands the bus to spi_begin()
+	StaticSemaphore_t claim_done_buf;
+
+	spi_xfer_t* q_head; // queued descriptors, FIFO
+	spi_xfer_t* q_tail;
+	spi_xfer_t* cur;       // descriptor on the wire
+	uint8_t cur_seg;       // index into cur->segs
+	uint8_t claimed;       // a blocking session owns the bus
+	uint8_t claim_pending; // spi_begin() waits for cur to finish
+	volatile uint8_t abort_state;
+
+	// chunk cursor of the segment on the wire
+	const uint8_t* seg_tx; // NULL: clock out dummy bytes from scratch_buf
+	uint8_t* seg_rx;       // NULL: discard MISO into scratch_buf
+	size_t seg_left;       // bytes not yet handed to EasyDMA
+} spim_ctx_t;
+
+static spim_ctx_t spim_ctx[SPI_BUS_COUNT] = {
+	[SPI_BUS_0] = {.regs = SPIM0_REGS, .irqn = SPIM0_IRQn, .fast = 0},
+	[SPI_BUS_3] = {.regs = SPIM3_REGS, .irqn = SPIM3_IRQn, .fast = 1},
+};
+
+void spim_init(spi_bus_t bus, const spi_pins_t* pins) {
+	configASSERT(bus < SPI_BUS_COUNT);
+	spim_ctx_t* c = &spim_ctx[bus];
+	NRF_SPIM_Type* spim = c->regs;
+
+	// 16/32 MHz on SPIM3 needs high drive on the clock and data outputs
+	uint32_t drive = c->fast ? (3 << 8) : (0 << 8); // H0H1 : S0S1
+
+	/* ---------------- SCK pin ---------------- */
+	spim->PSEL.SCK = (0 << 31) | // CONNECT = 0 → Connected
+			 (0 << 5) |  // PORT = 0 → P0
+			 (pins->sck << 0);
+
+	GPIO_CNF(pins->sck) = (1 << 0) | // DIR = Output
+			      (1 << 1) | // INPUT = Disconnect
+			      (0 << 2) | // No pull
+			      drive |	 // Standard / high drive
+			      (0 << 16); // No sense
+
+	/* ---------------- MOSI pin ---------------- */
+	spim->PSEL.MOSI = (0 << 31) | (0 << 5) | (pins->mosi << 0);
+
+	GPIO_CNF(pins->mosi) = (1 << 0) | // Output
+			       (1 << 1) | // Disconnect input
+			       (0 << 2) | drive | (0 << 16);
+
+	/* ---------------- MISO pin ---------------- */
+	spim->PSEL.MISO = (0 << 31) | (0 << 5) | (pins->miso << 0);
+
+	GPIO_CNF(pins->miso) = (0 << 0) | // DIR = Input
+			       (0 << 1) | // INPUT = Connected
+			       (0 << 2) | // No pull (depends on slave)
+			       (0 << 8) | (0 << 16);
+
+	/* --------Set registers to known state ----- */
+	spim->CONFIG = (0 << 0) |     // CPHA = 0
+		       (0 << 1) |     // CPOL = 0
+		       (0 << 2);      // ORDER = 0 → MSB first
+	spim->FREQUENCY = 0x10000000; // 1 MHz
+	spim->ORC = 0xFF;
+
+	spim->EVENTS_END = 0;
+	spim->EVENTS_STARTED = 0;
+	spim->EVENTS_STOPPED = 0;
+
+	spim->TXD.PTR = 0;
+	spim->TXD.MAXCNT = 0;
+	spim->RXD.PTR = 0;
+	spim->RXD.MAXCNT = 0;
+	spim->SHORTS = 0;
+	spim->INTENCLR = 0xFFFFFFFF;
+
+	// Create mutex for SPI bus access
+	c->bus_mutex = xSemaphoreCreateMutexStatic(&c->bus_mutex_buf);
+	if (c->bus_mutex == NULL) {
+		configASSERT(0);
+		for (;;)
+			;
+	}
+
+	// Transfer completion, signalled from the IRQ handler
+	c->xfer_done = xSemaphoreCreateBinaryStatic(&c->xfer_done_buf);
+	c->claim_done = xSemaphoreCreateBinaryStatic(&c->claim_done_buf);
+	if (c->xfer_done == NULL || c->claim_done == NULL) {
+		configASSERT(0);
+		for (;;)
+			;
+	}
+
+	spim->INTENSET = (1 << 6); // END - drives the transaction engine
+
+	NVIC_SetPriority(c->irqn, SPI_IRQ_PRIORITY);
+	NVIC_ClearPendingIRQ(c->irqn);
+	NVIC_EnableIRQ(c->irqn);
+
+	/* ---------------- Enable SPIM ---------------- */
+	spim->ENABLE = 7;
+}
+
+void spi_device_init(const spi_device_t* dev) {
+	configASSERT(dev->bus < SPI_BUS_COUNT);
+
+	// only SPIM3 can clock above 8 MHz
+	if (!spim_ctx[dev->bus].fast) {
+		configASSERT(dev->frequency != SPI_FREQ_16M && dev->frequency != SPI_FREQ_32M);
+	}
+
+	GPIO_CNF(dev->cs_pin) = (1 << 0) | // DIR = 1 → Output
+				(1 << 1) | // INPUT = 1 → Disconnect input buffer
+				(0 << 2) | // PULL = 00 → Disabled
+				(0 << 8) | // DRIVE = 000 → Standard drive (S0S1)
+				(0 << 16); // SENSE = Disabled
+	pin_high(dev->cs_pin);
+}
+
+static uint8_t check_buf_in_ram(const uint8_t* buf, size_t len) {
+	uintptr_t ram_lo = (uintptr_t)&__ram_start__;
+	uintptr_t ram_hi = (uintptr_t)&__ram_end__; // exclusive end
+
+	uintptr_t p = (uintptr_t)buf;
+
+	// Null pointer is never acceptable
+	if (p == 0) {
+		return 0;
+	}
+
+	// For zero-length, require p to be a valid in-range address (not one-past-end)
+	if (len == 0) {
+		return (p >= ram_lo && p < ram_hi) ? 1 : 0;
+	}
+
+	// Compute end with overflow guard
+	uintptr_t q = p + len;
+	if (q < p) { // overflow
+		return 0;
+	}
+
+	// Range [p, q) must lie within [ram_lo, ram_hi)
+	return (p >= ram_lo && q <= ram_hi) ? 1 : 0;
+}
+
+static void dev_apply(spim_ctx_t* c, const spi_device_t* dev) {
+	uint32_t order = 0;
+	switch (dev->order) {
+	case SPI_MSB_FIRST:
+		order = 0;
+		break;
+	case SPI_LSB_FIRST:
+		order = 1;
+		break;
+	}
+
+	uint32_t cfg = 0;
+	switch (dev->mode) {
+	case SPI_MODE_1:
+		cfg = (1 << 0) | (0 << 1) | (order << 2);
+		break;
+	case SPI_MODE_2:
+		cfg = (0 << 0) | (1 << 1) | (order << 2);
+		break;
+	case SPI_MODE_3:
+		cfg = (1 << 0) | (1 << 1) | (order << 2);
+		break;
+	case SPI_MODE_0:
+	default:
+		cfg = (0 << 0) | (0 << 1) | (order << 2);
+	}
+
+	c->regs->CONFIG = cfg;
+	c->regs->FREQUENCY = dev->frequency;
+	c->regs->ORC = dev->dummy_byte;
+
+	c->regs->EVENTS_END = 0;
+	c->regs->EVENTS_STARTED = 0;
+	c->regs->EVENTS_STOPPED = 0;
+}
+
+static TickType_t xfer_timeout_ticks(size_t len) {
+	// wire time at 1 MHz (ceil ms), slower clocks are not used for long transfers
+	uint32_t wire_ms = (uint32_t)((len * 8u + 999u) / 1000u);
+
+	return SPI_TIMEOUT_TICKS + pdMS_TO_TICKS(wire_ms);
+}
+
+static void seg_begin(spim_ctx_t* c, const spi_seg_t* s) {
+	c->seg_tx = s->tx;
+	c->seg_rx = s->rx;
+	c->seg_left = s->len;
+
+	if (s->tx == NULL) {
+		size_t fill = (s->len < SPI_SCRATCH_SIZE) ? s->len : SPI_SCRATCH_SIZE;
+		size_t i = 0;
+		while (i < fill) {
+			c->scratch_buf[i++] = c->cur->dev->dummy_byte;
+		}
+	}
+}
+
+// Programs the next chunk into TXD/RXD and advances the cursor
+static void seg_load(spim_ctx_t* c) {
+	size_t n = c->seg_left;
+
+	// scratch_buf backs one side of the transfer - it bounds the chunk
+	size_t cap = (c->seg_tx == NULL || c->seg_rx == NULL) ? SPI_SCRATCH_SIZE : SPIM_MAXCNT_MAX;
+	if (n > cap)
+		n = cap;
+
+	c->regs->TXD.PTR = (c->seg_tx != NULL) ? (uintptr_t)c->seg_tx : (uintptr_t)c->scratch_buf;
+	c->regs->TXD.MAXCNT = n;
+	c->regs->RXD.PTR = (c->seg_rx != NULL) ? (uintptr_t)c->seg_rx : (uintptr_t)c->scratch_buf;
+	c->regs->RXD.MAXCNT = n;
+
+	if (c->seg_tx != NULL)
+		c->seg_tx += n;
+	if (c->seg_rx != NULL)
+		c->seg_rx += n;
+	c->seg_left -= n;
+}
+
+// Puts x on the wire. Called with the engine idle, from a critical section or the ISR.
+static void engine_run(spim_ctx_t* c, spi_xfer_t* x) {
+	c->cur = x;
+	c->cur_seg = 0;
+
+	if (!(x->flags & XFER_SESSION)) {
+		dev_apply(c, x->dev);
+		pin_low(x->dev->cs_pin);
+	}
+
+	seg_begin(c, &x->segs[0]);
+	seg_load(c);
+	c->regs->TASKS_START = 1;
+}
+
+// Starts the next queued descriptor unless a blocking session owns or wants the bus
+static void engine_next(spim_ctx_t* c) {
+	if (c->cur != NULL)
+		return;
+
+	if (c->claim_pending) {
+		// only reached from the ISR: claim_pending is set while cur is busy
+		c->claim_pending = 0;
+		c->claimed = 1;
+
+		BaseType_t woken = pdFALSE;
+		xSemaphoreGiveFromISR(c->claim_done, &woken);
+		portYIELD_FROM_ISR(woken);
+		return;
+	}
+
+	if (c->claimed || c->q_head == NULL)
+		return;
+
+	spi_xfer_t* x = c->q_head;
+	c->q_head = x->next;
+	if (c->q_head == NULL)
+		c->q_tail = NULL;
+	x->next = NULL;
+
+	engine_run(c, x);
+}
+
+// Completes cur in interrupt context and moves on to the next descriptor
+static void engine_finish(spim_ctx_t* c, int status) {
+	spi_xfer_t* x = c->cur;
+	c->cur = NULL;
+
+	if (x == NULL)
+		return;
+
+	if (!(x->flags & XFER_SESSION))
+		pin_high(x->dev->cs_pin);
+
+	x->status = status;
+
+	if (x->done != NULL)
+		x->done(x, status);
+
+	if (x->notify != NULL) {
+		BaseType_t woken = pdFALSE;
+		vTaskNotifyGiveIndexedFromISR(x->notify, SPI_NOTIFY_INDEX, &woken);
+		portYIELD_FROM_ISR(woken);
+	}
+
+	engine_next(c);
+}
+
+// Stops a wedged transfer from task context; the ISR then completes it with -1
+static void engine_abort(spim_ctx_t* c) {
+	taskENTER_CRITICAL();
+	uint8_t busy = (c->cur != NULL);
+	if (busy)
+		c->abort_state = ABORT_STOPPING;
+	taskEXIT_CRITICAL();
+
+	if (!busy)
+		return;
+
+	c->regs->TASKS_STOP = 1;
+
+	TickType_t stop_start = xTaskGetTickCount();
+	while (c->regs->EVENTS_STOPPED == 0 &&
+		(xTaskGetTickCount() - stop_start) < pdMS_TO_TICKS(5)) {
+		vTaskDelay(1);
+	}
+
+	taskENTER_CRITICAL();
+	c->regs->EVENTS_END = 0;
+	c->regs->EVENTS_STOPPED = 0;
+	c->regs->EVENTS_STARTED = 0;
+
+	c->abort_state = ABORT_FINISH;
+	NVIC_SetPendingIRQ(c->irqn);
+	taskEXIT_CRITICAL();
+}
+
+static void spim_irq(spim_ctx_t* c) {
+	if (c->abort_state == ABORT_FINISH) {
+		c->abort_state = ABORT_NONE;
+		engine_finish(c, -1);
+		return;
+	}
+
+	if (c->regs->EVENTS_END == 0)
+		return;
+
+	c->regs->EVENTS_END = 0;
+	(void)c->regs->EVENTS_END; // flush the write before returning from the ISR
+
+	// being stopped by engine_abort(): do not chain, the abort completes cur
+	if (c->abort_state == ABORT_STOPPING || c->cur == NULL)
+		return;
+
+	if (c->seg_left == 0 && ++c->cur_seg < c->cur->seg_count)
+		seg_begin(c, &c->cur->segs[c->cur_seg]);
+
+	if (c->seg_left > 0) {
+		// chain the next chunk - CS stays asserted, nobody gets woken up
+		seg_load(c);
+		c->regs->TASKS_START = 1;
+		return;
+	}
+
+	engine_finish(c, 0);
+}
+
+void SPIM0_IRQHandler(void) {
+	spim_irq(&spim_ctx[SPI_BUS_0]);
+}
+
+void SPIM3_IRQHandler(void) {
+	spim_irq(&spim_ctx[SPI_BUS_3]);
+}
+
+static uint8_t seg_valid(const spi_seg_t* s) {
+	if (s->len == 0 || (s->tx == NULL && s->rx == NULL))
+		return 0;
+
+	if (s->tx != NULL && !check_buf_in_ram(s->tx, s->len))
+		return 0;
+
+	if (s->rx != NULL && !check_buf_in_ram(s->rx, s->len))
+		return 0;
+
+	return 1;
+}
+
+int spi_submit(spi_xfer_t* xfer) {
+	if (xfer == NULL || xfer->dev == NULL || xfer->segs == NULL || xfer->seg_count == 0)
+		return -1;
+
+	if (xfer->dev->bus >= SPI_BUS_COUNT)
+		return -1;
+
+	for (uint8_t i = 0; i < xfer->seg_count; i++) {
+		if (!seg_valid(&xfer->segs[i]))
+			return -1;
+	}
+
+	spim_ctx_t* c = &spim_ctx[xfer->dev->bus];
+
+	xfer->status = SPI_XFER_PENDING;
+	xfer->flags = 0;
+	xfer->next = NULL;
+
+	// also called from completion callbacks to chain the next transaction
+	uint8_t in_isr = (xPortIsInsideInterrupt() == pdTRUE);
+	UBaseType_t saved = 0;
+	if (in_isr)
+		saved = taskENTER_CRITICAL_FROM_ISR();
+	else
+		taskENTER_CRITICAL();
+
+	if (c->q_tail != NULL)
+		c->q_tail->next = xfer;
+	else
+		c->q_head = xfer;
+	c->q_tail = xfer;
+
+	engine_next(c);
+
+	if (in_isr)
+		taskEXIT_CRITICAL_FROM_ISR(saved);
+	else
+		taskEXIT_CRITICAL();
+
+	return 0;
+}
+
+int spi_begin(const spi_device_t* dev) {
+	spim_ctx_t* c = &spim_ctx[dev->bus];
+
+	BaseType_t ok = xSemaphoreTake(c->bus_mutex, portMAX_DELAY);
+
+	if (ok != pdTRUE) {
+		logger_log_uint_len("SPI BEGIN:",
+			(uint8_t)(sizeof("SPI BEGIN:") - 1),
+			&dev->cs_pin,
+			(uint8_t)sizeof(dev->cs_pin));
+
+		logger_log_literal_len("SPI BEGIN:",
+			(uint8_t)(sizeof("SPI BEGIN:") - 1),
+			"MUTEX TAKE FAILED",
+			(uint8_t)(sizeof("MUTEX TAKE FAILED") - 1));
+
+		return -1;
+	}
+
+	configASSERT(c->active_dev == NULL);
+
+	// Wait for the queued/async work on the wire to finish, then keep the engine to ourselves
+	uint8_t granted = 0;
+	taskENTER_CRITICAL();
+	if (c->cur == NULL && !c->claimed) {
+		c->claimed = 1;
+		granted = 1;
+	} else {
+		c->claim_pending = 1;
+	}
+	taskEXIT_CRITICAL();
+
+	if (!granted &&
+		xSemaphoreTake(c->claim_done, xfer_timeout_ticks(SPIM_MAXCNT_MAX)) != pdTRUE) {
+		logger_log_literal_len("SPI BEGIN:",
+			(uint8_t)(sizeof("SPI BEGIN:") - 1),
+			"ASYNC TIMEOUT",
+			(uint8_t)(sizeof("ASYNC TIMEOUT") - 1));
+
+		// the aborted descriptor completes with -1 and the engine grants the claim
+		engine_abort(c);
+		ok = xSemaphoreTake(c->claim_done, pdMS_TO_TICKS(5));
+		configASSERT(ok == pdTRUE);
+	}
+
+	dev_apply(c, dev);
+
+	pin_low(dev->cs_pin);
+	c->active_dev = dev;
+
+	return 0;
+}
+
+static void session_done(spi_xfer_t* x, int status) {
+	(void)status;
+
+	spim_ctx_t* c = &spim_ctx[x->dev->bus];
+
+	BaseType_t woken = pdFALSE;
+	xSemaphoreGiveFromISR(c->xfer_done, &woken);
+	portYIELD_FROM_ISR(woken);
+}
+
+// Blocking transfer inside the spi_begin/spi_end window: one engine descriptor, waited on here.
+// tx must be NULL or in RAM. The caller sleeps for the whole transfer instead of polling.
+static int xfer_run(spim_ctx_t* c, const uint8_t* tx, uint8_t* rx, size_t len) {
+	spi_seg_t s = {.tx = tx, .rx = rx, .len = len};
+	spi_xfer_t x = {0};
+	x.dev = c->active_dev;
+	x.segs = &s;
+	x.seg_count = 1;
+	x.done = session_done;
+	x.status = SPI_XFER_PENDING;
+	x.flags = XFER_SESSION;
+
+	// drop a completion left over from an earlier transfer that timed out
+	(void)xSemaphoreTake(c->xfer_done, 0);
+
+	// claimed bus: the engine is idle, so x goes straight on the wire
+	taskENTER_CRITICAL();
+	engine_run(c, &x);
+	taskEXIT_CRITICAL();
+
+	if (xSemaphoreTake(c->xfer_done, xfer_timeout_ticks(len)) == pdTRUE)
+		return x.status;
+
+	engine_abort(c);
+
+	// x lives on this stack - wait until the ISR is done with it
+	BaseType_t ok = xSemaphoreTake(c->xfer_done, pdMS_TO_TICKS(5));
+	configASSERT(ok == pdTRUE);
+
+	return x.status;
+}
+
+// Same as xfer_run(), but stages tx through tx_staging_buf when EasyDMA cannot read it (flash)
+static int xfer_run_staged(spim_ctx_t* c, const uint8_t* tx, uint8_t* rx, size_t len) {
+	if (tx == NULL || check_buf_in_ram(tx, len))
+		return xfer_run(c, tx, rx, len);
+
+	size_t off = 0;
+	while (off < len) {
+		size_t n = len - off;
+		if (n > SPI_SCRATCH_SIZE)
+			n = SPI_SCRATCH_SIZE;
+
+		mem_cpy(c->tx_staging_buf, tx + off, n);
+		if (xfer_run(c, c->tx_staging_buf, (rx != NULL) ? rx + off : NULL, n) != 0)
+			return -1;
+
+		off += n;
+	}
+
+	return 0;
+}
+
+// write only
+int spi_tx(const spi_device_t* dev, const uint8_t* tx_buf, size_t tx_len) {
+	spim_ctx_t* c = &spim_ctx[dev->bus];
+
+	if (c->active_dev != dev) {
+		logger_log_literal_len("SPI TX:",
+			(uint8_t)(sizeof("SPI TX:") - 1),
+			"DEV NOT SET",
+			(uint8_t)(sizeof("DEV NOT SET") - 1));
+		configASSERT(0);
+		return -1;
+	}
+
+	if (tx_len == 0) {
+		logger_log_literal_len("SPI TX:",
+			(uint8_t)(sizeof("SPI TX:") - 1),
+			"NO SEND DATA",
+			(uint8_t)(sizeof("NO SEND DATA") - 1));
+		return -1;
+	}
+
+	if (tx_buf == NULL) {
+		logger_log_literal_len("SPI TX:",
+			(uint8_t)(sizeof("SPI TX:") - 1),
+			"NULL TX BUF",
+			(uint8_t)(sizeof("NULL TX BUF") - 1));
+		configASSERT(0);
+		return -1;
+	}
+
+	// MISO is clocked into scratch and discarded
+	if (xfer_run_staged(c, tx_buf, NULL, tx_len) != 0) {
+		logger_log_literal_len("SPI TX:",
+			(uint8_t)(sizeof("SPI TX:") - 1),
+			"TIMEOUT",
+			(uint8_t)(sizeof("TIMEOUT") - 1));
+
+		return -1;
+	}
+
+	return 0;
+}
+
+// read only
+int spi_rx(const spi_device_t* dev, uint8_t* rx_buf, size_t rx_len) {
+	spim_ctx_t* c = &spim_ctx[dev->bus];
+
+	if (c->active_dev != dev) {
+		logger_log_literal_len("SPI RX:",
+			(uint8_t)(sizeof("SPI RX:") - 1),
+			"DEV NOT SET",
+			(uint8_t)(sizeof("DEV NOT SET") - 1));
+		configASSERT(0);
+		return -1;
+	}
+
+	if (rx_len == 0) {
+		logger_log_literal_len("SPI RX:",
+			(uint8_t)(sizeof("SPI RX:") - 1),
+			"NO RECEIVE DATA",
+			(uint8_t)(sizeof("NO RECEIVE DATA") - 1));
+		return -1;
+	}
+
+	if (rx_buf == NULL) {
+		logger_log_literal_len("SPI RX:",
+			(uint8_t)(sizeof("SPI RX:") - 1),
+			"NULL RX BUF",
+			(uint8_t)(sizeof("NULL RX BUF") - 1));
+		configASSERT(0);
+		return -1;
+	}
+	if (!check_buf_in_ram(rx_buf, rx_len)) {
+		logger_log_literal_len("SPI RX:",
+			(uint8_t)(sizeof("SPI RX:") - 1),
+			"RX BUF NOT IN RAM",
+			(uint8_t)(sizeof("RX BUF NOT IN RAM") - 1));
+		configASSERT(0);
+		return -1;
+	}
+
+	if (xfer_run(c, NULL, rx_buf, rx_len) != 0) {
+		logger_log_literal_len("SPI RX:",
+			(uint8_t)(sizeof("SPI RX:") - 1),
+			"TIMEOUT",
+			(uint8_t)(sizeof("TIMEOUT") - 1));
+
+		return -1;
+	}
+
+	return 0;
+}
+
+// read-write
+int spi_txrx(const spi_device_t* dev, const uint8_t* tx_buf, uint8_t* rx_buf, size_t len) {
+	spim_ctx_t* c = &spim_ctx[dev->bus];
+
+	if (c->active_dev != dev) {
+		logger_log_literal_len("SPI TXRX:",
+			(uint8_t)(sizeof("SPI TXRX:") - 1),
+			"DEV NOT SET",
+			(uint8_t)(sizeof("DEV NOT SET") - 1));
+		configASSERT(0);
+		return -1;
+	}
+
+	if (len == 0) {
+		logger_log_literal_len("SPI TXRX:",
+			(uint8_t)(sizeof("SPI TXRX:") - 1),
+			"NO SEND DATA",
+			(uint8_t)(sizeof("NO SEND DATA") - 1));
+		return -1;
+	}
+
+	if (tx_buf == NULL) {
+		logger_log_literal_len("SPI TXRX:",
+			(uint8_t)(sizeof("SPI TXRX:") - 1),
+			"NULL TX BUF",
+			(uint8_t)(sizeof("NULL TX BUF") - 1));
+		configASSERT(0);
+		return -1;
+	}
+
+	if (rx_buf == NULL) {
+		logger_log_literal_len("SPI TXRX:",
+			(uint8_t)(sizeof("SPI TXRX:") - 1),
+			"NULL RX BUF",
+			(uint8_t)(sizeof("NULL RX BUF") - 1));
+		configASSERT(0);
+		return -1;
+	}
+	if (!check_buf_in_ram(rx_buf, len)) {
+		logger_log_literal_len("SPI TXRX:",
+			(uint8_t)(sizeof("SPI TXRX:") - 1),
+			"RX BUF NOT IN RAM",
+			(uint8_t)(sizeof("RX BUF NOT IN RAM") - 1));
+		configASSERT(0);
+		return -1;
+	}
+
+	if (xfer_run_staged(c, tx_buf, rx_buf, len) != 0) {
+		logger_log_literal_len("SPI TXRX:",
+			(uint8_t)(sizeof("SPI TXRX:") - 1),
+			"TIMEOUT",
+			(uint8_t)(sizeof("TIMEOUT") - 1));
+
+		return -1;
+	}
+
+	return 0;
+}
+
+int spi_end(const spi_device_t* dev) {
+	spim_ctx_t* c = &spim_ctx[dev->bus];
+
+	if (c->active_dev != dev)
+		return -1;
+
+	pin_high(dev->cs_pin);
+	c->active_dev = NULL;
+
+	// let queued async descriptors run again
+	taskENTER_CRITICAL();
+	c->claimed = 0;
+	engine_next(c);
+	taskEXIT_CRITICAL();
+
+	xSemaphoreGive(c->bus_mutex);
+	return 0;
+}
@@ -0,0 +1,303 @@
+// Generated by tools/gen_routes.py from build/host/routes_128.tbl - do not edit
+#include "memutils.h"
+#include "modules/http_routes.h"
+
+int route_bench(const http_req_t* req, const uint8_t* buf, http_resp_t* resp);
+
+#define ROUTE_SLOTS 512u
+
+static const http_route_t exact_routes[128] = {
+	{"/api/v1/item001", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item002", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item003", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item004", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item005", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item006", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item007", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item008", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item009", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item010", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item011", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item012", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item013", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item014", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item015", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item016", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item017", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item018", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item019", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item020", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item021", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item022", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item023", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item024", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item025", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item026", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item027", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item028", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item029", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item030", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item031", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item032", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item033", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item034", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item035", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item036", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item037", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item038", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item039", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item040", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item041", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item042", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item043", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item044", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item045", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item046", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item047", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item048", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item049", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item050", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item051", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item052", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item053", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item054", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item055", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item056", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item057", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item058", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item059", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item060", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item061", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item062", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item063", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item064", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item065", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item066", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item067", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item068", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item069", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item070", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item071", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item072", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item073", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item074", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item075", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item076", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item077", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item078", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item079", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item080", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item081", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item082", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item083", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item084", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item085", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item086", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item087", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item088", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item089", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item090", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item091", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item092", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item093", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item094", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item095", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item096", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item097", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item098", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item099", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item100", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item101", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item102", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item103", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item104", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item105", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item106", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item107", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item108", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item109", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item110", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item111", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item112", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item113", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item114", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item115", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item116", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item117", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item118", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item119", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item120", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item121", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item122", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item123", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item124", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item125", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item126", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item127", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item128", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+};
+
+// slot -> index into exact_routes, 0xFF = empty
+static const uint8_t route_slots[ROUTE_SLOTS] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 126, 0xFF, 23, 0xFF, 0xFF, 0xFF, 0xFF, 97, 0xFF, 0xFF, 0xFF, 0xFF, 34, 0xFF, 58, 0xFF, 87, 0xFF, 0xFF, 0xFF, 3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 121, 106, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 96, 0xFF, 0xFF, 110, 0xFF, 0xFF, 45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 8, 14, 0xFF, 0xFF, 0xFF, 72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 64, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 91, 0xFF, 0xFF, 115, 107, 19, 42, 0xFF, 0xFF, 85, 0xFF, 0xFF, 0xFF, 117, 9, 30, 0xFF, 54, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 61, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 125, 102, 24, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 33, 0xFF, 57, 78, 88, 0xFF, 0xFF, 0xFF, 4, 0xFF, 0xFF, 0xFF, 0xFF, 76, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 105, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 95, 0xFF, 0xFF, 111, 0xFF, 0xFF, 46, 0xFF, 0xFF, 81, 0xFF, 0xFF, 0xFF, 0xFF, 13, 0xFF, 0xFF, 50, 71, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 127, 65, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 116, 0xFF, 20, 39, 0xFF, 0xFF, 86, 0xFF, 0xFF, 0xFF, 118, 12, 29, 0xFF, 53, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0, 0xFF, 0xFF, 0xFF, 62, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 120, 101, 25, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 27, 0xFF, 0xFF, 77, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 38, 0xFF, 67, 75, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 104, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 90, 0xFF, 0xFF, 112, 0xFF, 0xFF, 43, 0xFF, 0xFF, 82, 0xFF, 0xFF, 0xFF, 0xFF, 16, 0xFF, 0xFF, 49, 70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 66, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 124, 0xFF, 21, 40, 0xFF, 0xFF, 83, 0xFF, 0xFF, 0xFF, 0xFF, 11, 36, 0xFF, 56, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 119, 100, 26, 0xFF, 0xFF, 0xFF, 0xFF, 94, 0xFF, 0xFF, 0xFF, 18, 28, 47, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 37, 0xFF, 68, 74, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 103, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 89, 0xFF, 0xFF, 113, 0xFF, 0xFF, 44, 0xFF, 0xFF, 79, 0xFF, 0xFF, 0xFF, 0xFF, 15, 32, 0xFF, 52, 69, 0xFF, 0xFF, 0xFF, 0xFF, 1, 0xFF, 0xFF, 0xFF, 59, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 123, 0xFF, 22, 0xFF, 0xFF, 0xFF, 84, 98, 0xFF, 0xFF, 0xFF, 0xFF, 35, 0xFF, 55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 122, 99, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 93, 0xFF, 0xFF, 109, 17, 0xFF, 48, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 7, 0xFF, 0xFF, 0xFF, 0xFF, 73, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 63, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 92, 0xFF, 0xFF, 114, 108, 0xFF, 41, 0xFF, 0xFF, 80, 0xFF, 0xFF, 0xFF, 0xFF, 10, 31, 0xFF, 51, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 2, 0xFF, 0xFF, 0xFF, 60, 0xFF};
+
+#define PREFIX_COUNT 1u
+
+// longest first
+static const http_route_t prefix_routes[PREFIX_COUNT] = {
+	{"/", 1, 1, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+};
+
+static uint32_t route_hash(const uint8_t* key, uint16_t len) {
+	uint32_t h = 2166136261u ^ 1u;
+	for (uint16_t i = 0; i < len; i++) {
+		h ^= key[i];
+		h *= 16777619u;
+	}
+	return h;
+}
+
+const http_route_t* http_route_find(const uint8_t* path, uint16_t len) {
+	uint8_t idx = route_slots[route_hash(path, len) & (ROUTE_SLOTS - 1u)];
+	if (idx != 0xFF) {
+		const http_route_t* r = &exact_routes[idx];
+		if (r->path_len == len && mem_cmp(r->path, path, len) == 0)
+			return r;
+	}
+
+	for (uint8_t i = 0; i < PREFIX_COUNT; i++) {
+		const http_route_t* r = &prefix_routes[i];
+		if (r->path_len <= len && mem_cmp(r->path, path, r->path_len) == 0)
+			return r;
+	}
+
+	return NULL;
+}
@@ -0,0 +1,79 @@
+// Generated by tools/gen_routes.py from build/host/routes_16.tbl - do not edit
+#include "memutils.h"
+#include "modules/http_routes.h"
+
+int route_bench(const http_req_t* req, const uint8_t* buf, http_resp_t* resp);
+
+#define ROUTE_SLOTS 32u
+
+static const http_route_t exact_routes[16] = {
+	{"/api/v1/item001", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item002", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item003", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item004", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item005", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item006", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item007", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item008", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item009", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item010", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item011", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item012", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item013", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item014", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item015", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item016", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+};
+
+// slot -> index into exact_routes, 0xFF = empty
+static const uint8_t route_slots[ROUTE_SLOTS] = {3, 0xFF, 10, 15, 7, 2, 5, 0xFF, 0xFF, 13, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 11, 0xFF, 0xFF, 1, 4, 0xFF, 9, 14, 8, 0xFF, 6, 0xFF, 0xFF, 12, 0xFF, 0xFF, 0};
+
+#define PREFIX_COUNT 1u
+
+// longest first
+static const http_route_t prefix_routes[PREFIX_COUNT] = {
+	{"/", 1, 1, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+};
+
+static uint32_t route_hash(const uint8_t* key, uint16_t len) {
+	uint32_t h = 2166136261u ^ 0u;
+	for (uint16_t i = 0; i < len; i++) {
+		h ^= key[i];
+		h *= 16777619u;
+	}
+	return h;
+}
+
+const http_route_t* http_route_find(const uint8_t* path, uint16_t len) {
+	uint8_t idx = route_slots[route_hash(path, len) & (ROUTE_SLOTS - 1u)];
+	if (idx != 0xFF) {
+		const http_route_t* r = &exact_routes[idx];
+		if (r->path_len == len && mem_cmp(r->path, path, len) == 0)
+			return r;
+	}
+
+	for (uint8_t i = 0; i < PREFIX_COUNT; i++) {
+		const http_route_t* r = &prefix_routes[i];
+		if (r->path_len <= len && mem_cmp(r->path, path, r->path_len) == 0)
+			return r;
+	}
+
+	return NULL;
+}
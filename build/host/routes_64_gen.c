@@ -0,0 +1,175 @@
+// Generated by tools/gen_routes.py from build/host/routes_64.tbl - do not edit
+#include "memutils.h"
+#include "modules/http_routes.h"
+
+int route_bench(const http_req_t* req, const uint8_t* buf, http_resp_t* resp);
+
+#define ROUTE_SLOTS 128u
+
+static const http_route_t exact_routes[64] = {
+	{"/api/v1/item001", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item002", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item003", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item004", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item005", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item006", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item007", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item008", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item009", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item010", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item011", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item012", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item013", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item014", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item015", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item016", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item017", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item018", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item019", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item020", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item021", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item022", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item023", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item024", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item025", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item026", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item027", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item028", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item029", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item030", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item031", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item032", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item033", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item034", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item035", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item036", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item037", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item038", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item039", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item040", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item041", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item042", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item043", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item044", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item045", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item046", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item047", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item048", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item049", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item050", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item051", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item052", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item053", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item054", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item055", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item056", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item057", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item058", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item059", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item060", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item061", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item062", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item063", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+	{"/api/v1/item064", 15, 0, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+};
+
+// slot -> index into exact_routes, 0xFF = empty
+static const uint8_t route_slots[ROUTE_SLOTS] = {33, 0xFF, 57, 0xFF, 15, 32, 0xFF, 52, 4, 23, 0xFF, 0xFF, 0xFF, 1, 0xFF, 43, 0xFF, 59, 0xFF, 34, 0xFF, 58, 0xFF, 16, 0xFF, 0xFF, 49, 3, 22, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 46, 0xFF, 0xFF, 0xFF, 35, 0xFF, 55, 0xFF, 13, 0xFF, 0xFF, 50, 6, 21, 40, 0xFF, 0xFF, 0xFF, 0xFF, 45, 0xFF, 0xFF, 11, 36, 0xFF, 56, 8, 14, 0xFF, 0xFF, 0xFF, 5, 20, 39, 0xFF, 0xFF, 17, 0xFF, 48, 0xFF, 0xFF, 12, 29, 0xFF, 53, 7, 26, 0xFF, 0xFF, 0xFF, 0, 19, 42, 0xFF, 62, 18, 28, 47, 0xFF, 63, 9, 30, 0xFF, 54, 0xFF, 25, 37, 0xFF, 0xFF, 0xFF, 0xFF, 41, 0xFF, 61, 0xFF, 27, 0xFF, 0xFF, 0xFF, 10, 31, 0xFF, 51, 0xFF, 24, 38, 0xFF, 0xFF, 2, 0xFF, 44, 0xFF, 60, 0xFF};
+
+#define PREFIX_COUNT 1u
+
+// longest first
+static const http_route_t prefix_routes[PREFIX_COUNT] = {
+	{"/", 1, 1, {route_bench, NULL},
+		(const uint8_t*)"HTTP/1.1 405 Method Not Allowed\r\nAllow: GET, HEAD\r\nContent-Length: 0\r\n", 70},
+};
+
+static uint32_t route_hash(const uint8_t* key, uint16_t len) {
+	uint32_t h = 2166136261u ^ 1u;
+	for (uint16_t i = 0; i < len; i++) {
+		h ^= key[i];
+		h *= 16777619u;
+	}
+	return h;
+}
+
+const http_route_t* http_route_find(const uint8_t* path, uint16_t len) {
+	uint8_t idx = route_slots[route_hash(path, len) & (ROUTE_SLOTS - 1u)];
+	if (idx != 0xFF) {
+		const http_route_t* r = &exact_routes[idx];
+		if (r->path_len == len && mem_cmp(r->path, path, len) == 0)
+			return r;
+	}
+
+	for (uint8_t i = 0; i < PREFIX_COUNT; i++) {
+		const http_route_t* r = &prefix_routes[i];
+		if (r->path_len <= len && mem_cmp(r->path, path, r->path_len) == 0)
+			return r;
+	}
+
+	return NULL;
+}
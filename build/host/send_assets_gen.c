@@ -0,0 +1,2117 @@
+// Generated by tools/pack_assets.py from build/host/send_web/ - do not edit
+#include "memutils.h"
+#include "modules/assets.h"
+
+// /big.txt
+static const uint8_t a0_head[] = "HTTP/1.1 200 OK\r\nContent-Type: text/plain; charset=utf-8\r\nContent-Length: 32768\r\nVary: Accept-Encoding\r\nETag: \"e6603bcbae68896c\"\r\nCache-Control: no-cache\r\n";
+static const uint8_t a0_304[] = "HTTP/1.1 304 Not Modified\r\nVary: Accept-Encoding\r\nETag: \"e6603bcbae68896c\"\r\nCache-Control: no-cache\r\n";
+static const uint8_t a0_body[] = {
+	0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c,
+	0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e,
+	0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b,
+	0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78,
+	0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a,
+	0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67,
+	0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39,
+	0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56,
+	0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73,
+	0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45,
+	0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62,
+	0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34,
+	0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51,
+	0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e,
+	0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40,
+	0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d,
+	0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a,
+	0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c,
+	0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69,
+	0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b,
+	0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58,
+	0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75,
+	0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47,
+	0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64,
+	0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36,
+	0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53,
+	0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70,
+	0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42,
+	0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f,
+	0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31,
+	0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e,
+	0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b,
+	0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d,
+	0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a,
+	0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77,
+	0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49,
+	0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66,
+	0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38,
+	0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55,
+	0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72,
+	0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44,
+	0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61,
+	0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33,
+	0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50,
+	0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d,
+	0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f,
+	0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c,
+	0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79,
+	0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b,
+	0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68,
+	0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a,
+	0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57,
+	0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74,
+	0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46,
+	0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63,
+	0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35,
+	0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52,
+	0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f,
+	0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41,
+	0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e,
+	0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30,
+	0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d,
+	0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a,
+	0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c,
+	0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59,
+	0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76,
+	0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48,
+	0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65,
+	0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37,
+	0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54,
+	0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71,
+	0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43,
+	0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60,
+	0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32,
+	0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f,
+	0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c,
+	0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e,
+	0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b,
+	0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78,
+	0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a,
+	0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67,
+	0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39,
+	0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56,
+	0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73,
+	0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45,
+	0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62,
+	0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34,
+	0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51,
+	0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e,
+	0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40,
+	0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d,
+	0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a,
+	0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c,
+	0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69,
+	0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b,
+	0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58,
+	0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75,
+	0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47,
+	0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64,
+	0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36,
+	0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53,
+	0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70,
+	0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42,
+	0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f,
+	0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31,
+	0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e,
+	0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b,
+	0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d,
+	0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a,
+	0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77,
+	0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49,
+	0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66,
+	0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38,
+	0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55,
+	0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72,
+	0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44,
+	0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61,
+	0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33,
+	0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50,
+	0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d,
+	0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f,
+	0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c,
+	0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79,
+	0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b,
+	0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68,
+	0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a,
+	0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57,
+	0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74,
+	0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46,
+	0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63,
+	0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35,
+	0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52,
+	0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f,
+	0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41,
+	0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e,
+	0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30,
+	0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d,
+	0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a,
+	0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c,
+	0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59,
+	0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76,
+	0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48,
+	0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65,
+	0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37,
+	0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54,
+	0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71,
+	0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43,
+	0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60,
+	0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32,
+	0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f,
+	0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c,
+	0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e,
+	0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b,
+	0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78,
+	0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a,
+	0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67,
+	0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39,
+	0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56,
+	0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73,
+	0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45,
+	0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62,
+	0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34,
+	0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51,
+	0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e,
+	0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40,
+	0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d,
+	0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a,
+	0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c,
+	0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69,
+	0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b,
+	0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58,
+	0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75,
+	0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47,
+	0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64,
+	0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36,
+	0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53,
+	0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70,
+	0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42,
+	0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f,
+	0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31,
+	0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e,
+	0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b,
+	0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d,
+	0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a,
+	0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77,
+	0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49,
+	0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66,
+	0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38,
+	0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55,
+	0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72,
+	0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44,
+	0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61,
+	0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33,
+	0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50,
+	0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d,
+	0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f,
+	0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c,
+	0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79,
+	0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b,
+	0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68,
+	0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a,
+	0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57,
+	0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74,
+	0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46,
+	0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63,
+	0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35,
+	0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52,
+	0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f,
+	0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41,
+	0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e,
+	0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30,
+	0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d,
+	0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a,
+	0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c,
+	0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59,
+	0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76,
+	0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48,
+	0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65,
+	0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37,
+	0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54,
+	0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71,
+	0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43,
+	0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60,
+	0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32,
+	0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f,
+	0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c,
+	0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e,
+	0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b,
+	0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78,
+	0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a,
+	0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67,
+	0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39,
+	0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56,
+	0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73,
+	0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45,
+	0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62,
+	0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34,
+	0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51,
+	0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e,
+	0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40,
+	0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d,
+	0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a,
+	0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c,
+	0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69,
+	0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b,
+	0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58,
+	0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75,
+	0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47,
+	0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64,
+	0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36,
+	0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53,
+	0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70,
+	0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42,
+	0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f,
+	0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31,
+	0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e,
+	0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b,
+	0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d,
+	0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a,
+	0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77,
+	0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49,
+	0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66,
+	0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38,
+	0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55,
+	0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72,
+	0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44,
+	0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61,
+	0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33,
+	0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50,
+	0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d,
+	0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f,
+	0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c,
+	0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79,
+	0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b,
+	0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68,
+	0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a,
+	0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57,
+	0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74,
+	0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46,
+	0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63,
+	0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35,
+	0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52,
+	0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f,
+	0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41,
+	0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e,
+	0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30,
+	0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d,
+	0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a,
+	0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c,
+	0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59,
+	0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76,
+	0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48,
+	0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65,
+	0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37,
+	0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54,
+	0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71,
+	0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43,
+	0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60,
+	0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32,
+	0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f,
+	0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c,
+	0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e,
+	0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b,
+	0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78,
+	0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a,
+	0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67,
+	0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39,
+	0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56,
+	0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73,
+	0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45,
+	0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62,
+	0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34,
+	0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51,
+	0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e,
+	0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40,
+	0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d,
+	0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a,
+	0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c,
+	0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69,
+	0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b,
+	0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58,
+	0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75,
+	0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47,
+	0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64,
+	0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36,
+	0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53,
+	0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70,
+	0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42,
+	0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f,
+	0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31,
+	0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e,
+	0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b,
+	0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d,
+	0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a,
+	0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77,
+	0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49,
+	0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66,
+	0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38,
+	0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55,
+	0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72,
+	0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44,
+	0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61,
+	0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33,
+	0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50,
+	0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d,
+	0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f,
+	0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c,
+	0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79,
+	0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b,
+	0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68,
+	0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a,
+	0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57,
+	0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74,
+	0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46,
+	0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63,
+	0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35,
+	0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52,
+	0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f,
+	0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41,
+	0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e,
+	0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30,
+	0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d,
+	0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a,
+	0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c,
+	0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59,
+	0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76,
+	0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48,
+	0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65,
+	0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37,
+	0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54,
+	0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71,
+	0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43,
+	0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60,
+	0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32,
+	0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f,
+	0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c,
+	0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e,
+	0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b,
+	0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78,
+	0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a,
+	0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67,
+	0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39,
+	0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56,
+	0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73,
+	0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45,
+	0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62,
+	0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34,
+	0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51,
+	0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e,
+	0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40,
+	0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d,
+	0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a,
+	0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c,
+	0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69,
+	0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b,
+	0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58,
+	0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75,
+	0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47,
+	0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64,
+	0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36,
+	0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53,
+	0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70,
+	0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42,
+	0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f,
+	0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31,
+	0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e,
+	0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b,
+	0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d,
+	0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a,
+	0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77,
+	0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49,
+	0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66,
+	0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38,
+	0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55,
+	0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72,
+	0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44,
+	0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61,
+	0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33,
+	0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50,
+	0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d,
+	0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f,
+	0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c,
+	0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79,
+	0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b,
+	0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68,
+	0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a,
+	0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57,
+	0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74,
+	0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46,
+	0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63,
+	0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35,
+	0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52,
+	0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f,
+	0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41,
+	0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e,
+	0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30,
+	0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d,
+	0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a,
+	0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c,
+	0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59,
+	0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76,
+	0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48,
+	0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65,
+	0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37,
+	0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54,
+	0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71,
+	0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43,
+	0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60,
+	0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32,
+	0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f,
+	0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c,
+	0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e,
+	0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b,
+	0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78,
+	0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a,
+	0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67,
+	0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39,
+	0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56,
+	0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73,
+	0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45,
+	0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62,
+	0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34,
+	0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51,
+	0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e,
+	0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40,
+	0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d,
+	0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a,
+	0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c,
+	0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69,
+	0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b,
+	0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58,
+	0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75,
+	0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47,
+	0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64,
+	0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36,
+	0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53,
+	0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70,
+	0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42,
+	0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f,
+	0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31,
+	0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e,
+	0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b,
+	0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d,
+	0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a,
+	0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77,
+	0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49,
+	0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66,
+	0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38,
+	0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55,
+	0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72,
+	0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44,
+	0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61,
+	0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33,
+	0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50,
+	0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d,
+	0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f,
+	0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c,
+	0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79,
+	0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b,
+	0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68,
+	0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a,
+	0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57,
+	0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74,
+	0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46,
+	0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63,
+	0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35,
+	0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52,
+	0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f,
+	0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41,
+	0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e,
+	0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30,
+	0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d,
+	0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a,
+	0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c,
+	0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59,
+	0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76,
+	0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48,
+	0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65,
+	0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37,
+	0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54,
+	0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71,
+	0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43,
+	0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60,
+	0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32,
+	0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f,
+	0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c,
+	0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e,
+	0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b,
+	0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78,
+	0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a,
+	0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67,
+	0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39,
+	0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56,
+	0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73,
+	0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45,
+	0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62,
+	0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34,
+	0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51,
+	0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e,
+	0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40,
+	0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d,
+	0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a,
+	0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c,
+	0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69,
+	0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b,
+	0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58,
+	0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75,
+	0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47,
+	0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64,
+	0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36,
+	0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53,
+	0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70,
+	0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42,
+	0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f,
+	0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31,
+	0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e,
+	0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b,
+	0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d,
+	0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a,
+	0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77,
+	0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49,
+	0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66,
+	0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38,
+	0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55,
+	0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72,
+	0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44,
+	0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61,
+	0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33,
+	0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50,
+	0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d,
+	0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f,
+	0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c,
+	0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79,
+	0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b,
+	0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68,
+	0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a,
+	0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57,
+	0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74,
+	0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46,
+	0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63,
+	0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35,
+	0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52,
+	0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f,
+	0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41,
+	0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e,
+	0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30,
+	0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d,
+	0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a,
+	0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c,
+	0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59,
+	0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76,
+	0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48,
+	0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65,
+	0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37,
+	0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54,
+	0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71,
+	0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43,
+	0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60,
+	0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32,
+	0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f,
+	0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c,
+	0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e,
+	0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b,
+	0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78,
+	0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a,
+	0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67,
+	0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39,
+	0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56,
+	0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73,
+	0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45,
+	0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62,
+	0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34,
+	0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51,
+	0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e,
+	0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40,
+	0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d,
+	0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a,
+	0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c,
+	0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69,
+	0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b,
+	0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58,
+	0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75,
+	0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47,
+	0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64,
+	0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36,
+	0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53,
+	0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70,
+	0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42,
+	0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f,
+	0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31,
+	0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e,
+	0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b,
+	0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d,
+	0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a,
+	0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77,
+	0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49,
+	0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66,
+	0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38,
+	0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55,
+	0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72,
+	0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44,
+	0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61,
+	0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33,
+	0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50,
+	0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d,
+	0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f,
+	0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c,
+	0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79,
+	0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b,
+	0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68,
+	0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a,
+	0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57,
+	0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74,
+	0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46,
+	0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63,
+	0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35,
+	0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52,
+	0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f,
+	0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41,
+	0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e,
+	0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30,
+	0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d,
+	0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a,
+	0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c,
+	0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59,
+	0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76,
+	0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48,
+	0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65,
+	0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37,
+	0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54,
+	0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71,
+	0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43,
+	0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60,
+	0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32,
+	0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f,
+	0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c,
+	0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e,
+	0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b,
+	0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78,
+	0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a,
+	0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67,
+	0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39,
+	0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56,
+	0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73,
+	0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45,
+	0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62,
+	0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34,
+	0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51,
+	0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e,
+	0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40,
+	0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d,
+	0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a,
+	0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c,
+	0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69,
+	0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b,
+	0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58,
+	0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75,
+	0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47,
+	0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64,
+	0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36,
+	0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53,
+	0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70,
+	0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42,
+	0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f,
+	0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31,
+	0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e,
+	0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b,
+	0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d,
+	0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a,
+	0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77,
+	0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49,
+	0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66,
+	0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38,
+	0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55,
+	0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72,
+	0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44,
+	0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61,
+	0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33,
+	0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50,
+	0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d,
+	0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f,
+	0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c,
+	0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79,
+	0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b,
+	0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68,
+	0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a,
+	0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57,
+	0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74,
+	0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46,
+	0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63,
+	0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35,
+	0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52,
+	0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f,
+	0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41,
+	0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e,
+	0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30,
+	0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d,
+	0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a,
+	0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c,
+	0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59,
+	0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76,
+	0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48,
+	0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65,
+	0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37,
+	0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54,
+	0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71,
+	0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43,
+	0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60,
+	0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32,
+	0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f,
+	0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c,
+	0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e,
+	0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b,
+	0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78,
+	0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a,
+	0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67,
+	0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39,
+	0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56,
+	0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73,
+	0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45,
+	0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62,
+	0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34,
+	0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51,
+	0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e,
+	0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40,
+	0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d,
+	0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a,
+	0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c,
+	0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69,
+	0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b,
+	0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58,
+	0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75,
+	0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47,
+	0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64,
+	0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36,
+	0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53,
+	0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70,
+	0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42,
+	0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f,
+	0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31,
+	0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e,
+	0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b,
+	0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d,
+	0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a,
+	0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77,
+	0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49,
+	0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66,
+	0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38,
+	0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55,
+	0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72,
+	0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44,
+	0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61,
+	0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33,
+	0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50,
+	0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d,
+	0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f,
+	0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c,
+	0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79,
+	0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b,
+	0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68,
+	0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a,
+	0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57,
+	0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74,
+	0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46,
+	0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63,
+	0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35,
+	0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52,
+	0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f,
+	0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41,
+	0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e,
+	0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30,
+	0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d,
+	0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a,
+	0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c,
+	0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59,
+	0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76,
+	0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48,
+	0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65,
+	0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37,
+	0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54,
+	0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71,
+	0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43,
+	0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60,
+	0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32,
+	0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f,
+	0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c,
+	0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e,
+	0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b,
+	0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78,
+	0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a,
+	0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67,
+	0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39,
+	0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56,
+	0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73,
+	0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45,
+	0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62,
+	0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34,
+	0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51,
+	0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e,
+	0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40,
+	0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d,
+	0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a,
+	0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c,
+	0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69,
+	0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b,
+	0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58,
+	0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75,
+	0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47,
+	0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64,
+	0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36,
+	0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53,
+	0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70,
+	0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42,
+	0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f,
+	0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31,
+	0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e,
+	0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b,
+	0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d,
+	0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a,
+	0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77,
+	0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49,
+	0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66,
+	0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38,
+	0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55,
+	0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72,
+	0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44,
+	0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61,
+	0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33,
+	0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50,
+	0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d,
+	0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f,
+	0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c,
+	0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79,
+	0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b,
+	0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68,
+	0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a,
+	0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57,
+	0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74,
+	0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46,
+	0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63,
+	0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35,
+	0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52,
+	0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f,
+	0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41,
+	0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e,
+	0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30,
+	0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d,
+	0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a,
+	0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c,
+	0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59,
+	0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76,
+	0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48,
+	0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65,
+	0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37,
+	0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54,
+	0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71,
+	0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43,
+	0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60,
+	0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32,
+	0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f,
+	0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c,
+	0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e,
+	0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b,
+	0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78,
+	0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a,
+	0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67,
+	0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39,
+	0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56,
+	0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73,
+	0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45,
+	0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62,
+	0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34,
+	0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51,
+	0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e,
+	0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40,
+	0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d,
+	0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a,
+	0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c,
+	0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69,
+	0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b,
+	0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58,
+	0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75,
+	0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47,
+	0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64,
+	0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36,
+	0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53,
+	0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70,
+	0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42,
+	0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f,
+	0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31,
+	0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e,
+	0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b,
+	0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d,
+	0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a,
+	0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77,
+	0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49,
+	0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66,
+	0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38,
+	0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55,
+	0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72,
+	0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44,
+	0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61,
+	0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33,
+	0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50,
+	0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d,
+	0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f,
+	0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c,
+	0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79,
+	0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b,
+	0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68,
+	0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a,
+	0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57,
+	0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74,
+	0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46,
+	0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63,
+	0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35,
+	0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52,
+	0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f,
+	0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41,
+	0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e,
+	0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30,
+	0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d,
+	0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a,
+	0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c,
+	0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59,
+	0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76,
+	0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48,
+	0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65,
+	0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37,
+	0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54,
+	0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71,
+	0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43,
+	0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60,
+	0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32,
+	0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f,
+	0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c,
+	0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e,
+	0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b,
+	0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78,
+	0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a,
+	0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67,
+	0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39,
+	0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56,
+	0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73,
+	0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45,
+	0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62,
+	0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34,
+	0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51,
+	0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e,
+	0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40,
+	0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d,
+	0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a,
+	0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c,
+	0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69,
+	0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b,
+	0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58,
+	0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75,
+	0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47,
+	0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64,
+	0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36,
+	0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53,
+	0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70,
+	0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42,
+	0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f,
+	0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31,
+	0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e,
+	0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b,
+	0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d,
+	0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a,
+	0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77,
+	0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49,
+	0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66,
+	0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38,
+	0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55,
+	0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72,
+	0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44,
+	0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61,
+	0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33,
+	0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50,
+	0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d,
+	0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f,
+	0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c,
+	0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79,
+	0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b,
+	0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68,
+	0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a,
+	0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57,
+	0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74,
+	0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46,
+	0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63,
+	0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35,
+	0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52,
+	0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f,
+	0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41,
+	0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e,
+	0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30,
+	0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d,
+	0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a,
+	0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c,
+	0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59,
+	0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76,
+	0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48,
+	0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65,
+	0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37,
+	0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54,
+	0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71,
+	0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43,
+	0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60,
+	0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32,
+	0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f,
+	0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c,
+	0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e,
+	0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b,
+	0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78,
+	0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a,
+	0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67,
+	0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39,
+	0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56,
+	0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73,
+	0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45,
+	0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62,
+	0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34,
+	0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51,
+	0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e,
+	0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40,
+	0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d,
+	0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a,
+	0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c,
+	0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69,
+	0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b,
+	0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58,
+	0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75,
+	0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47,
+	0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64,
+	0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36,
+	0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53,
+	0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70,
+	0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42,
+	0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f,
+	0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31,
+	0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e,
+	0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b,
+	0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d,
+	0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a,
+	0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77,
+	0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49,
+	0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66,
+	0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38,
+	0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55,
+	0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72,
+	0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44,
+	0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61,
+	0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33,
+	0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50,
+	0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d,
+	0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f,
+	0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c,
+	0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79,
+	0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b,
+	0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68,
+	0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a,
+	0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57,
+	0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74,
+	0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46,
+	0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63,
+	0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35,
+	0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52,
+	0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f,
+	0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41,
+	0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e,
+	0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30,
+	0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d,
+	0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a,
+	0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c,
+	0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59,
+	0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76,
+	0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48,
+	0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65,
+	0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37,
+	0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54,
+	0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71,
+	0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43,
+	0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60,
+	0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32,
+	0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f,
+	0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c,
+	0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e,
+	0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b,
+	0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78,
+	0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a,
+	0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67,
+	0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39,
+	0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56,
+	0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73,
+	0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45,
+	0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62,
+	0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34,
+	0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51,
+	0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e,
+	0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40,
+	0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d,
+	0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a,
+	0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c,
+	0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69,
+	0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b,
+	0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58,
+	0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75,
+	0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47,
+	0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64,
+	0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36,
+	0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53,
+	0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70,
+	0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42,
+	0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f,
+	0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31,
+	0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e,
+	0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b,
+	0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d,
+	0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a,
+	0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77,
+	0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49,
+	0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66,
+	0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38,
+	0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55,
+	0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72,
+	0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44,
+	0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61,
+	0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33,
+	0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50,
+	0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d,
+	0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f,
+	0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c,
+	0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79,
+	0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b,
+	0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68,
+	0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a,
+	0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57,
+	0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74,
+	0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46,
+	0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63,
+	0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35,
+	0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52,
+	0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f,
+	0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41,
+	0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e,
+	0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30,
+	0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d,
+	0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a,
+	0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c,
+	0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59,
+	0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76,
+	0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48,
+	0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65,
+	0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37,
+	0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54,
+	0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71,
+	0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43,
+	0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60,
+	0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32,
+	0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f,
+	0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c,
+	0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e,
+	0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b,
+	0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78,
+	0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a,
+	0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67,
+	0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39,
+	0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56,
+	0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73,
+	0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45,
+	0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62,
+	0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34,
+	0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51,
+	0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e,
+	0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40,
+	0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d,
+	0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a,
+	0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c,
+	0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69,
+	0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b,
+	0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58,
+	0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75,
+	0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47,
+	0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64,
+	0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36,
+	0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53,
+	0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70,
+	0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42,
+	0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f,
+	0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31,
+	0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e,
+	0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b,
+	0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d,
+	0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a,
+	0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77,
+	0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49,
+	0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66,
+	0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38,
+	0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55,
+	0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72,
+	0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44,
+	0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61,
+	0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33,
+	0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50,
+	0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d,
+	0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f,
+	0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c,
+	0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79,
+	0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b,
+	0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68,
+	0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a,
+	0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57,
+	0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74,
+	0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46,
+	0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63,
+	0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35,
+	0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52,
+	0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f,
+	0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41,
+	0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e,
+	0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30,
+	0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d,
+	0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a,
+	0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c,
+	0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59,
+	0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76,
+	0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48,
+	0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65,
+	0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37,
+	0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54,
+	0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71,
+	0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43,
+	0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60,
+	0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32,
+	0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f,
+	0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c,
+	0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e,
+	0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b,
+	0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78,
+	0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a,
+	0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67,
+	0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39,
+	0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56,
+	0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73,
+	0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45,
+	0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62,
+	0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34,
+	0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51,
+	0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e,
+	0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40,
+	0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d,
+	0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a,
+	0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c,
+	0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69,
+	0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b,
+	0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58,
+	0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75,
+	0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47,
+	0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64,
+	0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36,
+	0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53,
+	0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70,
+	0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42,
+	0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f,
+	0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31,
+	0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e,
+	0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b,
+	0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d,
+	0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a,
+	0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77,
+	0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49,
+	0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66,
+	0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38,
+	0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55,
+	0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72,
+	0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44,
+	0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61,
+	0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33,
+	0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50,
+	0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d,
+	0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f,
+	0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c,
+	0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79,
+	0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b,
+	0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68,
+	0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a,
+	0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57,
+	0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74,
+	0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46,
+	0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63,
+	0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35,
+	0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52,
+	0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f,
+	0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41,
+	0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e,
+	0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30,
+	0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d,
+	0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a,
+	0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c,
+	0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59,
+	0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76,
+	0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48,
+	0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65,
+	0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37,
+	0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54,
+	0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71,
+	0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43,
+	0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60,
+	0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32,
+	0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f,
+	0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c,
+	0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e,
+	0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b,
+	0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78,
+	0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a,
+	0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67,
+	0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39,
+	0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56,
+	0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73,
+	0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45,
+	0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62,
+	0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34,
+	0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51,
+	0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e,
+	0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40,
+	0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d,
+	0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a,
+	0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c,
+	0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69,
+	0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b,
+	0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58,
+	0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75,
+	0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47,
+	0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64,
+	0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36,
+	0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53,
+	0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70,
+	0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42,
+	0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f,
+	0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31,
+	0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e,
+	0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b,
+	0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d,
+	0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a,
+	0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77,
+	0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49,
+	0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66,
+	0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38,
+	0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55,
+	0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72,
+	0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44,
+	0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61,
+	0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33,
+	0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50,
+	0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d,
+	0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f,
+	0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c,
+	0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79,
+	0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b,
+	0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68,
+	0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a,
+	0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57,
+	0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74,
+	0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46,
+	0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63,
+	0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35,
+	0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52,
+	0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f,
+	0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41,
+	0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e,
+	0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30,
+	0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d,
+	0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a,
+	0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c,
+	0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59,
+	0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76,
+	0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48,
+	0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65,
+	0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37,
+	0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54,
+	0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71,
+	0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43,
+	0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60,
+	0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32,
+	0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f,
+	0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c,
+	0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e,
+	0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b,
+	0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78,
+	0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a,
+	0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67,
+	0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39,
+	0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56,
+	0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73,
+	0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45,
+	0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62,
+	0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34,
+	0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51,
+	0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e,
+	0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40,
+	0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d,
+	0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a,
+	0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c,
+	0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69,
+	0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b,
+	0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58,
+	0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75,
+	0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47,
+	0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64,
+	0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36,
+	0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53,
+	0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70,
+	0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42,
+	0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f,
+	0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31,
+	0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e,
+	0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b,
+	0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d,
+	0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a,
+	0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77,
+	0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49,
+	0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66,
+	0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38,
+	0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55,
+	0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72,
+	0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44,
+	0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61,
+	0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33,
+	0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50,
+	0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d,
+	0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f,
+	0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c,
+	0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79,
+	0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b,
+	0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68,
+	0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a,
+	0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57,
+	0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74,
+	0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46,
+	0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63,
+	0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35,
+	0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52,
+	0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f,
+	0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41,
+	0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e,
+	0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30,
+	0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d,
+	0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a,
+	0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c,
+	0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59,
+	0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76,
+	0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48,
+	0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65,
+	0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37,
+	0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54,
+	0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71,
+	0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43,
+	0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60,
+	0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32,
+	0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f,
+	0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c,
+	0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e,
+	0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b,
+	0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78,
+	0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a,
+	0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67,
+	0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39,
+	0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56,
+	0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73,
+	0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45,
+	0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62,
+	0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34,
+	0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51,
+	0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e,
+	0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40,
+	0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d,
+	0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a,
+	0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c,
+	0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69,
+	0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b,
+	0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58,
+	0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75,
+	0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47,
+	0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64,
+	0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36,
+	0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53,
+	0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70,
+	0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42,
+	0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f,
+	0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31,
+	0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e,
+	0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b,
+	0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d,
+	0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a,
+	0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77,
+	0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49,
+	0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66,
+	0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38,
+	0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55,
+	0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72,
+	0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44,
+	0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61,
+	0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33,
+	0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50,
+	0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d,
+	0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f,
+	0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c,
+	0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79,
+	0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b,
+	0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68,
+	0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a,
+	0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57,
+	0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74,
+	0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46,
+	0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63,
+	0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35,
+	0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52,
+	0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f,
+	0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41,
+	0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e,
+	0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30,
+	0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d,
+	0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a,
+	0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c,
+	0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59,
+	0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76,
+	0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48,
+	0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65,
+	0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37,
+	0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54,
+	0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71,
+	0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43,
+	0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60,
+	0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32,
+	0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f,
+	0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c,
+	0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e,
+	0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b,
+	0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78,
+	0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a,
+	0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67,
+	0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39,
+	0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56,
+	0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73,
+	0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45,
+	0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62,
+	0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34,
+	0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51,
+	0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e,
+	0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40,
+	0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d,
+	0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a,
+	0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c,
+	0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69,
+	0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b,
+	0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58,
+	0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75,
+	0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47,
+	0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64,
+	0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36,
+	0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53,
+	0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70,
+	0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42,
+	0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f,
+	0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31,
+	0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e,
+	0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b,
+	0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d,
+	0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a,
+	0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77,
+	0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49,
+	0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66,
+	0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38,
+	0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55,
+	0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72,
+	0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44,
+	0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61,
+	0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33,
+	0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50,
+	0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d,
+	0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f,
+	0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c,
+	0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79,
+	0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b,
+	0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68,
+	0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a,
+	0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57,
+	0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74,
+	0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46,
+	0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63,
+	0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35,
+	0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52,
+	0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f,
+	0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41,
+	0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e,
+	0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30,
+	0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d,
+	0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a,
+	0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c,
+	0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59,
+	0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76,
+	0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48,
+	0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65,
+	0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37,
+	0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54,
+	0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71,
+	0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43,
+	0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60,
+	0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32,
+	0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f,
+	0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c,
+	0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e,
+	0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b,
+	0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78,
+	0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a,
+	0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67,
+	0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39,
+	0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56,
+	0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73,
+	0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45,
+	0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62,
+	0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34,
+	0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51,
+	0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e,
+	0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40,
+	0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d,
+	0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a,
+	0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c,
+	0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69,
+	0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b,
+	0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58,
+	0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75,
+	0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47,
+	0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64,
+	0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36,
+	0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53,
+	0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70,
+	0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42,
+	0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f,
+	0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31,
+	0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e,
+	0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b,
+	0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d,
+	0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a,
+	0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77,
+	0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49,
+	0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66,
+	0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38,
+	0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55,
+	0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72,
+	0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44,
+	0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61,
+	0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33,
+	0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50,
+	0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d,
+	0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f,
+	0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c,
+	0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79,
+	0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b,
+	0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68,
+	0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a,
+	0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57,
+	0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74,
+	0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46,
+	0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63,
+	0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35,
+	0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52,
+	0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f,
+	0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41,
+	0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e,
+	0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30,
+	0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d,
+	0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a,
+	0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c,
+	0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59,
+	0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76,
+	0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48,
+	0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65,
+	0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37,
+	0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54,
+	0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71,
+	0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43,
+	0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60,
+	0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32,
+	0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f,
+	0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c,
+	0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e,
+	0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b,
+	0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78,
+	0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a,
+	0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67,
+	0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39,
+	0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56,
+	0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73,
+	0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45,
+	0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62,
+	0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34,
+	0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51,
+	0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e,
+	0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40,
+	0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d,
+	0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a,
+	0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c,
+	0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69,
+	0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b,
+	0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58,
+	0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75,
+	0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47,
+	0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64,
+	0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36,
+	0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53,
+	0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70,
+	0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42,
+	0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f,
+	0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31,
+	0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e,
+	0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b,
+	0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d,
+	0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a,
+	0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77,
+	0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49,
+	0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66,
+	0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38,
+	0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55,
+	0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72,
+	0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44,
+	0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61,
+	0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33,
+	0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50,
+	0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d,
+	0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f,
+	0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c,
+	0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79,
+	0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b,
+	0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68,
+	0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a,
+	0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57,
+	0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74,
+	0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46,
+	0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63,
+	0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35,
+	0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52,
+	0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f,
+	0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41,
+	0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e,
+	0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30,
+	0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d,
+	0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a,
+	0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c,
+	0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59,
+	0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76,
+	0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48,
+	0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65,
+	0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37,
+	0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54,
+	0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71,
+	0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43,
+	0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60,
+	0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32,
+	0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f,
+	0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c,
+	0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e,
+	0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b,
+	0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78,
+	0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a,
+	0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67,
+	0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39,
+	0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56,
+	0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73,
+	0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45,
+	0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62,
+	0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34,
+	0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51,
+	0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e,
+	0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40,
+	0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d,
+	0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a,
+	0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c,
+	0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69,
+	0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b,
+	0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58,
+	0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75,
+	0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47,
+	0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64,
+	0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36,
+	0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53,
+	0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70,
+	0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42,
+	0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f,
+	0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31,
+	0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e,
+	0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b,
+	0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d,
+	0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a,
+	0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77,
+	0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49,
+	0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66,
+	0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38,
+	0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55,
+	0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72,
+	0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44,
+	0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61,
+	0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33,
+	0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50,
+	0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d,
+	0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f,
+	0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c,
+	0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79,
+	0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b,
+	0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68,
+	0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a,
+	0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57,
+	0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74,
+	0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46,
+	0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63,
+	0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35,
+	0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52,
+	0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f,
+	0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41,
+	0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e,
+	0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30,
+	0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d,
+	0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a,
+	0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c,
+	0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59,
+	0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76,
+	0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48,
+	0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65,
+	0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37,
+	0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54,
+	0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71,
+	0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43,
+	0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60,
+	0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32,
+	0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f,
+	0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c,
+	0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e,
+	0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b,
+	0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78,
+	0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a,
+	0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67,
+	0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39,
+	0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56,
+	0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73,
+	0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45,
+	0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62,
+	0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34,
+	0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51,
+	0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e,
+	0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40,
+	0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d,
+	0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a,
+	0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c,
+	0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69,
+	0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b,
+	0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58,
+	0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75,
+	0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47,
+	0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64,
+	0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36,
+	0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53,
+	0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70,
+	0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42,
+	0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f,
+	0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31,
+	0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e,
+	0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b,
+	0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d,
+	0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a,
+	0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77,
+	0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49,
+	0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66,
+	0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38,
+	0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55,
+	0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72,
+	0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44,
+	0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61,
+	0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33,
+	0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50,
+	0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d,
+	0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f,
+	0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c,
+	0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79,
+	0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b,
+	0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68,
+	0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a,
+	0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57,
+	0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74,
+	0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46,
+	0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63,
+	0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35,
+	0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52,
+	0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f,
+	0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41,
+	0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e,
+	0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30,
+	0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d,
+	0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a,
+	0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c,
+	0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59,
+	0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76,
+	0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48,
+	0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65,
+	0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37,
+	0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54,
+	0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71,
+	0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43,
+	0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60,
+	0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32,
+	0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f,
+	0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c,
+	0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e,
+	0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b,
+	0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78,
+	0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a,
+	0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67,
+	0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39,
+	0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56,
+	0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73,
+	0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45,
+	0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62,
+	0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34,
+	0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51,
+	0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e,
+	0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40,
+	0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d,
+	0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a,
+	0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c,
+	0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69,
+	0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b,
+	0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58,
+	0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75,
+	0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47,
+	0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64,
+	0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36,
+	0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53,
+	0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70,
+	0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42,
+	0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f,
+	0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31,
+	0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e,
+	0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b,
+	0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d,
+	0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a,
+	0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77,
+	0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49,
+	0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66,
+	0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38,
+	0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55,
+	0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72,
+	0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44,
+	0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61,
+	0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33,
+	0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50,
+	0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d,
+	0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f,
+	0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c,
+	0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79,
+	0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b,
+	0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68,
+	0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a,
+	0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57,
+	0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74,
+	0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46,
+	0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63,
+	0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35,
+	0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52,
+	0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f,
+	0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41,
+	0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e,
+	0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30,
+	0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d,
+	0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a,
+	0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c,
+	0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59,
+	0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76,
+	0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48,
+	0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65,
+	0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37,
+	0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54,
+	0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71,
+	0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43,
+	0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60,
+	0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32,
+	0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f,
+	0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c,
+	0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e,
+	0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b,
+	0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78,
+	0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a,
+	0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67,
+	0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39,
+	0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56,
+	0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73,
+	0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45,
+	0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62,
+	0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34,
+	0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51,
+	0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e,
+	0x4f, 0x30, 0x5c, 0x3d, 0x69, 0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40,
+	0x6c, 0x4d, 0x79, 0x5a, 0x3b, 0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d,
+	0x3e, 0x6a, 0x4b, 0x77, 0x58, 0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a,
+	0x5b, 0x3c, 0x68, 0x49, 0x75, 0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c,
+	0x78, 0x59, 0x3a, 0x66, 0x47, 0x73, 0x54, 0x35, 0x61, 0x42, 0x6e, 0x4f, 0x30, 0x5c, 0x3d, 0x69,
+	0x4a, 0x76, 0x57, 0x38, 0x64, 0x45, 0x71, 0x52, 0x33, 0x5f, 0x40, 0x6c, 0x4d, 0x79, 0x5a, 0x3b,
+	0x67, 0x48, 0x74, 0x55, 0x36, 0x62, 0x43, 0x6f, 0x50, 0x31, 0x5d, 0x3e, 0x6a, 0x4b, 0x77, 0x58,
+	0x39, 0x65, 0x46, 0x72, 0x53, 0x34, 0x60, 0x41, 0x6d, 0x4e, 0x7a, 0x5b, 0x3c, 0x68, 0x49, 0x75,
+	0x56, 0x37, 0x63, 0x44, 0x70, 0x51, 0x32, 0x5e, 0x3f, 0x6b, 0x4c, 0x78, 0x59, 0x3a, 0x66, 0x47,
+};
+static const uint8_t a0_gz_head[] = "HTTP/1.1 200 OK\r\nContent-Type: text/plain; charset=utf-8\r\nContent-Length: 233\r\nContent-Encoding: gzip\r\nVary: Accept-Encoding\r\nETag: \"e274e2f3c1f547f4\"\r\nCache-Control: no-cache\r\n";
+static const uint8_t a0_gz_304[] = "HTTP/1.1 304 Not Modified\r\nVary: Accept-Encoding\r\nETag: \"e274e2f3c1f547f4\"\r\nCache-Control: no-cache\r\n";
+static const uint8_t a0_gz_body[] = {
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0xcc, 0x09, 0x56, 0x41, 0x01,
+	0x00, 0x00, 0xc0, 0x2b, 0xfd, 0x16, 0x21, 0x8a, 0x24, 0x3b, 0x85, 0x28, 0x4b, 0x42, 0x11, 0x8a,
+	0x6c, 0x15, 0x4e, 0xef, 0x1c, 0xbd, 0x37, 0x73, 0x80, 0x09, 0xba, 0x57, 0xd3, 0xc2, 0xef, 0x53,
+	0xe4, 0xfd, 0x6e, 0x55, 0x3b, 0x7b, 0x4d, 0x7e, 0x95, 0xf7, 0xed, 0xd8, 0x47, 0x6e, 0xdb, 0xb8,
+	0x18, 0xde, 0x7e, 0x3f, 0x9c, 0xbc, 0x5c, 0xcf, 0x8a, 0x7f, 0xcf, 0xd1, 0x51, 0x66, 0x5d, 0x3f,
+	0xef, 0xdf, 0xcc, 0x2b, 0x87, 0x4e, 0x7c, 0x92, 0xff, 0x69, 0x86, 0xdf, 0xd2, 0xcb, 0xea, 0x69,
+	0x2f, 0xf1, 0x59, 0xda, 0xb5, 0x2e, 0xc7, 0xd9, 0xcd, 0x63, 0x68, 0x90, 0x5a, 0xdc, 0x07, 0x2a,
+	0x95, 0x4a, 0xa5, 0x52, 0xa9, 0x54, 0x2a, 0x95, 0x4a, 0xa5, 0x52, 0xa9, 0x54, 0x2a, 0x95, 0x4a,
+	0xa5, 0x52, 0xa9, 0x54, 0x2a, 0x95, 0x4a, 0xa5, 0x52, 0xa9, 0x54, 0x2a, 0x95, 0x4a, 0xa5, 0x52,
+	0xa9, 0x54, 0x2a, 0x95, 0x4a, 0xa5, 0x52, 0xa9, 0x54, 0x2a, 0x95, 0x4a, 0xa5, 0x52, 0xa9, 0x54,
+	0x2a, 0x95, 0x4a, 0xa5, 0x52, 0xa9, 0x54, 0x2a, 0x95, 0x4a, 0xa5, 0x52, 0xa9, 0x54, 0x2a, 0x95,
+	0x4a, 0xa5, 0x52, 0xa9, 0x54, 0x2a, 0x95, 0x4a, 0xa5, 0x52, 0xa9, 0x54, 0x2a, 0x95, 0x4a, 0xa5,
+	0x52, 0xa9, 0x54, 0x2a, 0x95, 0x4a, 0xa5, 0x52, 0xa9, 0x54, 0x2a, 0x95, 0x4a, 0xa5, 0x52, 0xa9,
+	0x54, 0x2a, 0x95, 0x4a, 0xa5, 0x52, 0xa9, 0x54, 0x2a, 0x95, 0x4a, 0xa5, 0x52, 0xfd, 0xd7, 0xea,
+	0x08, 0x69, 0xe8, 0xdd, 0xdc, 0x00, 0x80, 0x00, 0x00,
+};
+
+static const asset_t assets[1] = {
+	// /big.txt
+	{{a0_head, sizeof(a0_head) - 1, a0_body, 32768u,
+		a0_304, sizeof(a0_304) - 1, "\"e6603bcbae68896c\"", 18},
+		{a0_gz_head, sizeof(a0_gz_head) - 1, a0_gz_body, 233u,
+		a0_gz_304, sizeof(a0_gz_304) - 1, "\"e274e2f3c1f547f4\"", 18}},
+};
+
+static const struct {
+	const char* path;
+	uint8_t path_len;
+	uint8_t asset;
+} asset_keys[1] = {
+	{"/big.txt", 8, 0},
+};
+
+#define ASSET_SLOTS 1u
+
+// slot -> index into asset_keys, 0xFF = empty
+static const uint8_t asset_slots[ASSET_SLOTS] = {0};
+
+static uint32_t asset_hash(const uint8_t* key, uint16_t len) {
+	uint32_t h = 2166136261u ^ 0u;
+	for (uint16_t i = 0; i < len; i++) {
+		h ^= key[i];
+		h *= 16777619u;
+	}
+	return h;
+}
+
+const asset_t* assets_find(const uint8_t* path, uint16_t len) {
+	uint8_t idx = asset_slots[asset_hash(path, len) & (ASSET_SLOTS - 1u)];
+	if (idx == 0xFF)
+		return NULL;
+
+	if (asset_keys[idx].path_len != len || mem_cmp(asset_keys[idx].path, path, len) != 0)
+		return NULL;
+
+	return &assets[asset_keys[idx].asset];
+}
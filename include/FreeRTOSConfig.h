@@ -48,6 +48,9 @@
 #define configUSE_RECURSIVE_MUTEXES 1
 #define configUSE_COUNTING_SEMAPHORES 1
 
+/* Index 0 is general purpose, index 1 is SPI_NOTIFY_INDEX (spi_submit completions) */
+#define configTASK_NOTIFICATION_ARRAY_ENTRIES 2
+
 /*-----------------------------------------------------------
  * Software timers (DISABLED for now)
  *----------------------------------------------------------*/
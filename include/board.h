@@ -9,27 +9,12 @@
 #define GPIO_OUTSET_REG (GPIO_PORT->OUTSET)
 #define GPIO_OUTCLR_REG (GPIO_PORT->OUTCLR)
 
-/* SPIM */
-#define SPIM NRF_SPIM0
-#define SPIM_CONFIG_REG (SPIM->CONFIG)
-#define SPIM_FREQUENCY_REG (SPIM->FREQUENCY)
-#define SPIM_ENABLE_REG (SPIM->ENABLE)
-#define SPIM_EVENTS_END_REG (SPIM->EVENTS_END)
-#define SPIM_EVENTS_STARTED_REG (SPIM->EVENTS_STARTED)
-#define SPIM_EVENTS_STOPPED_REG (SPIM->EVENTS_STOPPED)
-#define SPIM_ORC_REG (SPIM->ORC)
-#define SPIM_TXD_PTR_REG (SPIM->TXD.PTR)
-#define SPIM_TXD_MAXCNT_REG (SPIM->TXD.MAXCNT)
-#define SPIM_RXD_PTR_REG (SPIM->RXD.PTR)
-#define SPIM_RXD_MAXCNT_REG (SPIM->RXD.MAXCNT)
-#define SPIM_TASKS_START_REG (SPIM->TASKS_START)
-#define SPIM_TASKS_STOP_REG (SPIM->TASKS_STOP)
-#define SPIM_SHORTS_REG (SPIM->SHORTS)
-#define SPIM_INTENCLR_REG (SPIM->INTENCLR)
-
-#define SPIM_PSEL_SCK_REG (SPIM->PSEL.SCK)
-#define SPIM_PSEL_MOSI_REG (SPIM->PSEL.MOSI)
-#define SPIM_PSEL_MISO_REG (SPIM->PSEL.MISO)
+/* SPIM instances (registers are reached through the driver's per-instance context) */
+#define SPIM0_REGS NRF_SPIM0
+#define SPIM0_IRQn SPIM0_SPIS0_TWIM0_TWIS0_SPI0_TWI0_IRQn
+#define SPIM0_IRQHandler SPIM0_SPIS0_TWIM0_TWIS0_SPI0_TWI0_IRQHandler
+#define SPIM3_REGS NRF_SPIM3 // the only instance that reaches 16/32 MHz
+// SPIM3_IRQn / SPIM3_IRQHandler come straight from the MDK
 
 /* UARTE */
 #define UARTE NRF_UARTE0
@@ -42,12 +27,23 @@
 #define UARTE_TASKS_STOPTX_REG (UARTE->TASKS_STOPTX)
 #define UARTE_EVENTS_ENDTX_REG (UARTE->EVENTS_ENDTX)
 #define UARTE_EVENTS_TXSTOPPED_REG (UARTE->EVENTS_TXSTOPPED)
+#define UARTE_INTENSET_REG (UARTE->INTENSET)
+#define UARTE_INTENCLR_REG (UARTE->INTENCLR)
+#define UARTE_IRQn UARTE0_UART0_IRQn
+#define UARTE_IRQHandler UARTE0_UART0_IRQHandler
 
 #define UARTE_PSEL_TXD_REG (UARTE->PSEL.TXD)
 #define UARTE_PSEL_RXD_REG (UARTE->PSEL.RXD)
 
+/* GPIOTE */
+#define GPIOTE NRF_GPIOTE
+#define GPIOTE_CONFIG_REG(ch) (GPIOTE->CONFIG[(ch)])
+#define GPIOTE_EVENTS_IN_REG(ch) (GPIOTE->EVENTS_IN[(ch)])
+#define GPIOTE_INTENSET_REG (GPIOTE->INTENSET)
+#define GPIOTE_INTENCLR_REG (GPIOTE->INTENCLR)
+
 /* GPIO Pins */
-// SPI
+// SPI - SPIM3, W5500
 #define SCK_PIN 2
 #define MOSI_PIN 26
 #define MISO_PIN 27
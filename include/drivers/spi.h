@@ -1,5 +1,7 @@
 #pragma once
 
+#include "FreeRTOS.h" // IWYU pragma: keep
+#include "task.h"
 #include <stddef.h>
 #include <stdint.h>
 
@@ -28,30 +30,96 @@ typedef uint32_t spi_frequency_t;
 #define SPI_FREQ_16M 0x0A000000u
 #define SPI_FREQ_32M 0x14000000u
 
+typedef enum {
+	SPI_BUS_0, // SPIM0, up to 8 MHz
+	SPI_BUS_3, // SPIM3, up to 32 MHz
+	SPI_BUS_COUNT,
+} spi_bus_t;
+
+typedef struct {
+	uint32_t sck;
+	uint32_t mosi;
+	uint32_t miso;
+} spi_pins_t;
+
 typedef struct {
+	spi_bus_t bus;
 	uint32_t cs_pin;
 	spi_mode_t mode;
 	spi_frequency_t frequency;
 	spi_bit_order_t order;
-	uint8_t dummy_byte; // 0x00 or 0xFF, used for rx-only transactions
+	uint8_t dummy_byte; // 0x00 or 0xFF, clocked out by SPIM (ORC) for rx-only transactions
 } spi_device_t;
 
-#define SPI_MAX_XFER 512
+// Bounce buffer size for flash sources (EasyDMA only reads RAM), two per instance. Transfers
+// themselves are not limited: longer ones run as chained EasyDMA segments inside the same CS
+// window, flash ones in SPI_STAGING_SIZE pieces, each copied by the IRQ handler while the one
+// before it is on the wire.
+#define SPI_STAGING_SIZE 512
 #define SPI_TIMEOUT_TICKS pdMS_TO_TICKS(50) // for v1 only
+// numerically >= configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY, the handler uses FromISR APIs
+#define SPI_IRQ_PRIORITY 6
+
+#define SPI_NOTIFY_INDEX 1 // task notification index used for spi_xfer_t.notify
+#define SPI_XFER_PENDING 1 // spi_xfer_t.status until the transaction completes
+
+// One leg of a transaction. rx must be in RAM (EasyDMA), tx may also be in flash (staged).
+typedef struct {
+	const uint8_t* tx; // NULL: clock out the device's dummy byte
+	uint8_t* rx;	   // NULL: discard what is received
+	size_t len;
+} spi_seg_t;
+
+typedef struct spi_xfer spi_xfer_t;
+
+// Runs in SPIM interrupt context - keep it short, FromISR APIs only
+typedef void (*spi_xfer_cb_t)(spi_xfer_t* xfer, int status);
 
-void spim_init(void);
+// Asynchronous transaction: CS is asserted for all segments, back to back.
+// Must stay alive and untouched until status leaves SPI_XFER_PENDING.
+struct spi_xfer {
+	const spi_device_t* dev;
+	const spi_seg_t* segs;
+	uint8_t seg_count;
+	spi_xfer_cb_t done;	// optional
+	TaskHandle_t notify;	// optional, notified on SPI_NOTIFY_INDEX
+	void* ctx;		// for the owner, not used by the driver
+	volatile int status;	// SPI_XFER_PENDING, then 0 or -1
+	// driver owned
+	spi_xfer_t* next;
+	uint8_t flags;
+};
+
+// Each instance has its own mutex, staging buffer and transaction engine
+void spim_init(spi_bus_t bus, const spi_pins_t* pins);
 
 // Static Hardware Setup only
 void spi_device_init(const spi_device_t* dev);
 
 // Transfers only valid b/w begin/end
 int spi_begin(const spi_device_t* dev); // stores active dev config (including dummy byte)
-int spi_end(void);			// deasserts CS and clears active dev config
+int spi_end(const spi_device_t* dev);	// deasserts CS and clears active dev config
 // must call spi_begin() before calling any functions below
 
-int spi_tx(const uint8_t* tx_buf, size_t tx_len); // write only
-int spi_rx(uint8_t* rx_buf,
+int spi_tx(const spi_device_t* dev, const uint8_t* tx_buf, size_t tx_len); // write only
+int spi_rx(const spi_device_t* dev,
+	uint8_t* rx_buf,
 	size_t rx_len); // read only - uses active dev’s dummy byte to clock reads
-int spi_txrx(const uint8_t* tx_buf, uint8_t* rx_buf, size_t len); // full duplex
+int spi_txrx(const spi_device_t* dev,
+	const uint8_t* tx_buf,
+	uint8_t* rx_buf,
+	size_t len); // full duplex
 
 // must call spi_end() after calling any functions above
+
+// Queues a transaction without taking the bus mutex. Runs after the transactions already queued,
+// never inside another caller's spi_begin/spi_end window. Callable from tasks and from done
+// callbacks. Returns -1 for an invalid descriptor.
+int spi_submit(spi_xfer_t* xfer);
+
+// Takes back a transaction from spi_submit() that is still pending: unlinked if queued, stopped
+// if on the wire. Once it returns, the driver is done with xfer and its buffers, and its done
+// callback and notification will not come; one delivered before the call may still be pending.
+// Task context only, it may sleep while SPIM stops. Returns the final status: -1, or 0 if it
+// completed after all.
+int spi_cancel(spi_xfer_t* xfer);
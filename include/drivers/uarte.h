@@ -3,8 +3,16 @@
 #include <stddef.h>
 #include <stdint.h>
 
-#define UART_TX_BUF_SIZE 256
+#define UART_TX_BUF_SIZE 256 // per DMA buffer, there are two
+#define UART_IRQ_PRIORITY 6  // numerically >= configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY
 
+// Streaming output: appends are packed back to back into one DMA buffer while the other one
+// is on the wire. A full buffer starts on its own, uarte_flush() starts a partial one.
+// Neither waits for the transfer, only for the wire to free a buffer.
+uint8_t uarte_append(const uint8_t* data, size_t len);
+uint8_t uarte_flush(void);
+
+// append + flush
 uint8_t uarte_write(const uint8_t* data, size_t len);
 void uarte_init(void);
 void uarte_recover(void);
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// One representation of an asset, both parts const in flash.
+// head = status line + headers, each ending in CRLF, without Connection and the blank line.
+typedef struct {
+	const uint8_t* head;
+	uint16_t head_len;
+	const uint8_t* body;
+	uint32_t body_len;
+	// 304 head carrying the same ETag, for a client that already has this body
+	const uint8_t* not_modified;
+	uint16_t not_modified_len;
+	const char* etag; // quoted, as it appears in the ETag header
+	uint8_t etag_len;
+} asset_rep_t;
+
+typedef struct {
+	asset_rep_t identity;
+	asset_rep_t gzip; // head NULL when gzip would not be smaller
+} asset_t;
+
+// Generated from web/ by tools/pack_assets.py. NULL if no asset has this path.
+const asset_t* assets_find(const uint8_t* path, uint16_t len);
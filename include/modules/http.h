@@ -0,0 +1,87 @@
+#pragma once
+
+#include <stdint.h>
+
+// Incremental HTTP/1.1 request parser.
+// The caller keeps the request in one linear buffer (buf[0] = first byte of the request) and
+// calls http_parse() again each time more bytes were appended. Parsing resumes where it
+// stopped, nothing is copied: every result is a slice into that buffer.
+// Lines must end in CRLF: RFC 9112 lets a recipient take a bare LF too, this one refuses it
+// rather than guess where a line ends. Empty lines before the request line are skipped.
+
+typedef struct {
+	uint16_t off; // from the start of the request
+	uint16_t len;
+} http_slice_t;
+
+typedef enum {
+	HTTP_METHOD_OTHER,
+	HTTP_METHOD_GET,
+	HTTP_METHOD_HEAD,
+	HTTP_METHOD_POST,
+} http_method_t;
+
+// Headers the server looks at, everything else is skipped
+typedef enum {
+	HTTP_HDR_HOST,
+	HTTP_HDR_CONNECTION,
+	HTTP_HDR_CONTENT_LENGTH,
+	HTTP_HDR_IF_NONE_MATCH,
+	HTTP_HDR_RANGE,
+	HTTP_HDR_ACCEPT_ENCODING,
+	HTTP_HDR_TRANSFER_ENCODING, // only so a chunked request body is refused, not misframed
+	HTTP_HDR_COUNT,
+} http_hdr_t;
+
+typedef enum {
+	HTTP_PARSE_MORE,  // head incomplete, append more bytes and call again
+	HTTP_PARSE_DONE,  // head complete, see head_len and body_left
+	HTTP_PARSE_ERROR, // malformed - answer 400 and close
+} http_parse_rc_t;
+
+typedef struct {
+	// parser position
+	uint8_t state;
+	uint8_t hdr;	// header being scanned, HTTP_HDR_COUNT if skipped
+	uint16_t pos;	// next byte to look at
+	uint16_t tok;	// start of the token being scanned
+	uint16_t trail; // end of the header value without trailing whitespace
+
+	// results
+	http_method_t method;
+	uint8_t version_minor; // HTTP/1.<minor>
+	http_slice_t target;
+	http_slice_t hdrs[HTTP_HDR_COUNT];
+	uint8_t hdr_seen; // bit n = hdrs[n] present
+	uint32_t content_length;
+	uint16_t head_len;  // request line + headers + blank line
+	uint32_t body_left; // body cursor: bytes of body not consumed yet
+} http_req_t;
+
+void http_req_init(http_req_t* req);
+
+// Parses buf[req->pos .. len). len only grows between calls for the same request.
+http_parse_rc_t http_parse(http_req_t* req, const uint8_t* buf, uint16_t len);
+
+// Target without the query string
+http_slice_t http_path(const http_req_t* req, const uint8_t* buf);
+
+// Advances the body cursor over up to avail bytes. Returns how many of them were body.
+uint32_t http_body_consume(http_req_t* req, uint32_t avail);
+
+// 1 if the comma separated value of hdr lists tok (case-insensitive), not refused with ;q=0
+int http_hdr_has_token(const http_req_t* req,
+	const uint8_t* buf,
+	http_hdr_t hdr,
+	const char* tok,
+	uint8_t tok_len);
+
+// 1 if If-None-Match is "*" or lists etag (quoted, weak comparison as RFC 9110 wants for it)
+int http_etag_match(const http_req_t* req, const uint8_t* buf, const char* etag, uint8_t etag_len);
+
+// 1 if the connection may stay open after this request (HTTP/1.1 default, 1.0 opt-in)
+int http_keep_alive(const http_req_t* req, const uint8_t* buf);
+
+static inline int http_has(const http_req_t* req, http_hdr_t hdr) {
+	return (req->hdr_seen >> hdr) & 1u;
+}
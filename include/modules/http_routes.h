@@ -0,0 +1,67 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "modules/http.h"
+
+// body_len of a generated body whose length is not known up front: it goes out chunked
+// (HTTP/1.0: unframed, then the connection closes). head must not carry Content-Length.
+#define HTTP_BODY_STREAM UINT32_MAX
+
+typedef struct http_resp http_resp_t;
+
+// Writes the next piece of a generated body, at most cap bytes, and returns its length.
+// 0 = end of body. cursor in resp is the generator's own, 0 on the first call. Called only
+// once the piece fits in the socket TX buffer: whatever it returns goes out.
+typedef uint16_t (*http_body_fill_t)(http_resp_t* resp, uint8_t* out, uint16_t cap);
+
+// A response as a handler hands it back. head and body are static and go out as they are.
+// head = status line + headers, each ending in CRLF, without Connection and the blank line
+// (net adds those). body_len must match the Content-Length in head.
+// A generated body sets fill instead of body, with its length in body_len or HTTP_BODY_STREAM.
+struct http_resp {
+	const uint8_t* head;
+	uint16_t head_len;
+	const uint8_t* body;
+	uint32_t body_len; // larger than the socket TX buffer is fine, it goes out in pieces
+	http_body_fill_t fill;
+	uint32_t cursor;
+};
+
+// Returns 0 with resp filled in (it starts zeroed), or -1 to answer 404
+typedef int (*http_handler_t)(const http_req_t* req, const uint8_t* buf, http_resp_t* resp);
+
+typedef struct {
+	const char* path; // without the '*' of a prefix route
+	uint8_t path_len;
+	uint8_t prefix;
+	http_handler_t handlers[2]; // GET, POST
+	const uint8_t* not_allowed; // 405 head listing the methods this path takes
+	uint8_t not_allowed_len;
+} http_route_t;
+
+// Route lookup, generated from src/modules/routes.tbl by tools/gen_routes.py.
+// Exact paths first (perfect hash, constant time), then prefix routes. NULL if nothing matches.
+const http_route_t* http_route_find(const uint8_t* path, uint16_t len);
+
+// Handler of route for method, NULL if the path does not take that method. HEAD uses GET.
+static inline http_handler_t http_route_handler(const http_route_t* route, http_method_t method) {
+	switch (method) {
+	case HTTP_METHOD_GET:
+	case HTTP_METHOD_HEAD:
+		return route->handlers[0];
+	case HTTP_METHOD_POST:
+		return route->handlers[1];
+	default:
+		return NULL;
+	}
+}
+
+#define HTTP_RESP_SET(resp, h, b)                                                                  \
+	do {                                                                                       \
+		(resp)->head = (h);                                                                \
+		(resp)->head_len = (uint16_t)(sizeof(h) - 1);                                      \
+		(resp)->body = (b);                                                                \
+		(resp)->body_len = (uint32_t)(sizeof(b) - 1);                                      \
+	} while (0)
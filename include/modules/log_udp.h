@@ -0,0 +1,19 @@
+#pragma once
+
+#include <stdint.h>
+
+// UDP log sink: the rendered log stream (the UART bytes, text lines and token frames) batched
+// into datagrams on NET_LOG_SOCK. Datagram = sequence number (LE16), then whole records, so
+// tools/log_collector.py can decode each one on its own and spot lost ones. Only logger_task
+// appends and sends; nothing here waits for the network, a batch that cannot go is dropped.
+
+// Opens the socket, from net_task once the network config is set. Records batched before
+// that go out with the first datagram.
+void log_udp_open(void);
+
+// Before each record of up to max_len bytes: sends the batch if the record might not fit
+void log_udp_record(uint16_t max_len);
+void log_udp_append(const uint8_t* data, uint16_t len);
+
+// Sends what is batched. Returns 1 if some of it has to wait for the previous datagram.
+uint8_t log_udp_flush(void);
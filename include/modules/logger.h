@@ -4,26 +4,59 @@
 #include <stdint.h>
 
 #define LOGGER_MAX_LOG_PAYLOAD 64
-#define LOGGER_QUEUE_CAP 64
 #define LOGGER_MAX_LOG_LABEL 16
+#ifndef LOGGER_RING_SIZE
+#define LOGGER_RING_SIZE 2048 // bytes of queued records, power of two
+#endif
+#define LOGGER_TOKEN_MAX_ARGS 4
+
+// Output sinks, both get the same stream. The UDP one (modules/log_udp.h) needs the network up.
+#ifndef LOGGER_UART
+#define LOGGER_UART 1
+#endif
+#ifndef LOGGER_UDP
+#define LOGGER_UDP 0
+#endif
+
+// Severity, most severe first. Call sites above LOG_LEVEL_MAX are compiled out entirely; the
+// rest are checked against the runtime level of their module before anything is copied.
+#define LOG_LEVEL_OFF 0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_INFO 3
+#define LOG_LEVEL_DEBUG 4
+
+#ifndef LOG_LEVEL_MAX
+#define LOG_LEVEL_MAX LOG_LEVEL_INFO // override with -DLOG_LEVEL_MAX=...
+#endif
+
+typedef enum {
+	LOG_MOD_APP,
+	LOG_MOD_SPI,
+	LOG_MOD_W5500,
+	LOG_MOD_NET,
+	LOG_MOD_HTTP,
+	LOG_MOD_COUNT,
+} log_module_t;
+
+// Runtime level per module, LOG_LEVEL_MAX at boot
+extern volatile uint8_t logger_levels[LOG_MOD_COUNT];
+void logger_set_level(log_module_t mod, uint8_t level);
+
+#define LOG_ON(lvl, mod) ((lvl) <= LOG_LEVEL_MAX && (lvl) <= logger_levels[(mod)])
 
 typedef enum {
 	LOG_HEX,
 	LOG_UINT,
 	LOG_STRING,
+	LOG_TOKEN,
 } payload_t;
 
-typedef struct {
-	payload_t type;
-	uint8_t label[LOGGER_MAX_LOG_LABEL];
-	uint8_t payload[LOGGER_MAX_LOG_PAYLOAD];
-	uint8_t len;
-} log_t;
-
 void logger_init(void);
-void logger_log(log_t log);
 void logger_task(void* arg); // freertos
 
+// Identical consecutive records are counted instead of queued, and replaced by one
+// "repeated N times" line when something else is logged.
 void logger_log_literal_len(const char* label,
 	uint8_t label_len,
 	const char* text,
@@ -36,3 +69,81 @@ void logger_log_hex_len(const char* label,
 	uint8_t label_len,
 	const uint8_t* data,
 	uint8_t data_len);
+
+// Filtered call sites for string literals and integer values
+#define LOG_TEXT(lvl, mod, label, text)                                                            \
+	do {                                                                                       \
+		if (LOG_ON(lvl, mod))                                                              \
+			logger_log_literal_len((label),                                            \
+				(uint8_t)(sizeof(label) - 1),                                      \
+				(text),                                                            \
+				(uint8_t)(sizeof(text) - 1));                                      \
+	} while (0)
+
+#define LOG_VALUE(lvl, mod, label, value_ptr)                                                      \
+	do {                                                                                       \
+		if (LOG_ON(lvl, mod))                                                              \
+			logger_log_uint_len((label),                                               \
+				(uint8_t)(sizeof(label) - 1),                                      \
+				(value_ptr),                                                       \
+				(uint8_t)sizeof(*(value_ptr)));                                    \
+	} while (0)
+
+// Tokenized logging, filtered like LOG_TEXT. The format string goes into .logstr, a section
+// that is linked at address 0 and never loaded (linker.ld), so its address is its ID and it
+// costs no flash. Only the ID and the raw argument words are queued and sent;
+// tools/log_decode.py formats them on the host from the ELF. Formats take printf-style
+// %u %d %x %X %c with flags and width.
+void logger_token(uint16_t id, uint8_t nargs, const uint32_t* args);
+
+#define LOG_FMT_(fmt) static const char log_fmt_[] __attribute__((section(".logstr"), used)) = fmt
+#define LOG_ID_ ((uint16_t)(uintptr_t)log_fmt_)
+
+#define LOG_TOKEN0(lvl, mod, fmt)                                                                  \
+	do {                                                                                       \
+		if (LOG_ON(lvl, mod)) {                                                            \
+			LOG_FMT_(fmt);                                                             \
+			logger_token(LOG_ID_, 0, NULL);                                            \
+		}                                                                                  \
+	} while (0)
+
+#define LOG_TOKEN1(lvl, mod, fmt, a)                                                               \
+	do {                                                                                       \
+		if (LOG_ON(lvl, mod)) {                                                            \
+			LOG_FMT_(fmt);                                                             \
+			const uint32_t log_args_[1] = {(uint32_t)(a)};                             \
+			logger_token(LOG_ID_, 1, log_args_);                                       \
+		}                                                                                  \
+	} while (0)
+
+#define LOG_TOKEN2(lvl, mod, fmt, a, b)                                                            \
+	do {                                                                                       \
+		if (LOG_ON(lvl, mod)) {                                                            \
+			LOG_FMT_(fmt);                                                             \
+			const uint32_t log_args_[2] = {(uint32_t)(a), (uint32_t)(b)};              \
+			logger_token(LOG_ID_, 2, log_args_);                                       \
+		}                                                                                  \
+	} while (0)
+
+#define LOG_TOKEN3(lvl, mod, fmt, a, b, c)                                                         \
+	do {                                                                                       \
+		if (LOG_ON(lvl, mod)) {                                                            \
+			LOG_FMT_(fmt);                                                             \
+			const uint32_t log_args_[3] = {(uint32_t)(a), (uint32_t)(b), (uint32_t)(c)}; \
+			logger_token(LOG_ID_, 3, log_args_);                                       \
+		}                                                                                  \
+	} while (0)
+
+#define LOG_TOKEN4(lvl, mod, fmt, a, b, c, d)                                                      \
+	do {                                                                                       \
+		if (LOG_ON(lvl, mod)) {                                                            \
+			LOG_FMT_(fmt);                                                             \
+			const uint32_t log_args_[4] = {                                            \
+				(uint32_t)(a), (uint32_t)(b), (uint32_t)(c), (uint32_t)(d)};       \
+			logger_token(LOG_ID_, 4, log_args_);                                       \
+		}                                                                                  \
+	} while (0)
+
+// On the UART a token record is a binary frame between the text lines:
+// LOG_FRAME_MARK, nargs, id (LE16), nargs LE32 words. 0xFF never occurs in the text output.
+#define LOG_FRAME_MARK 0xFF
@@ -7,14 +7,33 @@
 
 #define HTTP_SOCK_COUNT 4 // 4 sockets (0-7) for w5500
 #define HTTP_PORT 8080
+#define NET_SWEEP_TICKS pdMS_TO_TICKS(1000) // no INTn edge for 1 s: snapshot all sockets anyway
+#define NET_POLL_TICKS pdMS_TO_TICKS(5) // poll interval while a socket is between events
 
-// for ESTABLISHED socket state
-#define REQUEST_TIMEOUT_TICKS pdMS_TO_TICKS(1000) // close if no RX data arrives within the timeout
-// for CLOSE_WAIT socket state
-#define CLEANUP_TIMEOUT_TICKS pdMS_TO_TICKS(250) // close if no RX data arrives within the timeout
+// W5500 socket buffer profiles (KB per socket, sockets 0-7)
+#define NET_BUF_PROFILE_EVEN 0 // 2 KB TX / 2 KB RX on every socket
+#define NET_BUF_PROFILE_HTTP 1 // 4 KB TX on the HTTP sockets - one SEND per typical response
+#define NET_BUF_PROFILE NET_BUF_PROFILE_HTTP
+
+#define NET_REQ_BUF_SIZE 1536 // per connection, a request head that does not fit gets 431
+#define NET_TX_GEN_SIZE 512 // one generated body piece, chunk framing included
+
+// UDP log sink (LOGGER_UDP, modules/log_udp.c), on a socket the HTTP side does not use
+#define NET_LOG_SOCK 7
+#define NET_LOG_SRC_PORT 5140
+#define NET_LOG_DEST_IP {192, 168, 29, 2} // host running tools/log_collector.py
+#define NET_LOG_DEST_PORT 5140
+#define NET_LOG_BATCH 1024 // datagram payload, must fit the TX memory of NET_LOG_SOCK
+
+// Connection deadlines
+#define REQUEST_TIMEOUT_TICKS pdMS_TO_TICKS(1000) // whole request head must arrive within this
+#define SEND_TIMEOUT_TICKS pdMS_TO_TICKS(2000)	  // response must be queued and acked within this
+#define CLEANUP_TIMEOUT_TICKS pdMS_TO_TICKS(250)  // force close() if DISCON does not finish
+
+// Keep-alive
+#define NET_KEEPALIVE_IDLE_TICKS pdMS_TO_TICKS(5000) // next request head must arrive within this
+#define NET_KEEPALIVE_MAX_REQUESTS 100		    // then Connection: close
 
 // Initialize the networking module
 void net_init(void);
 
-// Initialize the porting layer for the W5500
-void w5500_init(void);
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "FreeRTOS.h" // IWYU pragma: keep
+#include "task.h"
+
+#define W5500_SOCK_COUNT 8
+
+// Status registers of one socket, taken from a single burst read (Sn_IR .. Sn_RX_RSR)
+typedef struct {
+	uint8_t ir;	 // Sn_IR
+	uint8_t sr;	 // Sn_SR
+	uint16_t tx_fsr; // Sn_TX_FSR less staged bytes
+	uint16_t rx_rsr; // Sn_RX_RSR - may under-report, never over-reports
+} w5500_sock_snap_t;
+
+#define W5500_BUF_TOTAL_KB 16 // TX and RX each
+
+// Socket buffer partitioning, KB per socket. Each size is 0, 1, 2, 4, 8 or 16 and each
+// direction sums to at most W5500_BUF_TOTAL_KB.
+typedef struct {
+	uint8_t tx_kb[W5500_SOCK_COUNT];
+	uint8_t rx_kb[W5500_SOCK_COUNT];
+} w5500_buf_plan_t;
+
+// Initialize the porting layer for the W5500 and partition its buffers by plan
+void w5500_init(const w5500_buf_plan_t* plan);
+
+// 0 if plan fits the chip, -1 otherwise
+int w5500_buf_plan_check(const w5500_buf_plan_t* plan);
+
+// Checks Sn_TX_FSR before a send of len bytes. Returns 0 if it fits right away,
+// otherwise counts a stall on sn and returns -1.
+int w5500_tx_room(uint8_t sn, uint16_t len);
+
+typedef struct {
+	const uint8_t* data;
+	uint16_t len;
+} w5500_tx_seg_t;
+
+// Builds one send straight in the TX memory of a socket: appends write at an advancing
+// offset from Sn_TX_WR (plus staged bytes), read once in begin. Commit publishes them all with
+// one Sn_TX_WR write and one SEND. The chip lock is held from begin to commit.
+typedef struct {
+	uint8_t sn;
+	uint16_t wr;   // TX memory offset of the next append, the chip wraps it
+	uint16_t room; // what is left of Sn_TX_FSR
+} w5500_tx_t;
+
+// Returns -1 without taking the lock if Sn_TX_FSR is short of len (counted as a stall)
+int w5500_tx_begin(w5500_tx_t* tx, uint8_t sn, uint16_t len);
+void w5500_tx_append(w5500_tx_t* tx, const uint8_t* data, uint16_t len);
+// Issues SEND without waiting for SENDOK: the next SEND on sn must wait for it
+void w5500_tx_commit(w5500_tx_t* tx);
+// Keeps the appends (len bytes) in TX memory past Sn_TX_WR, for while the previous SEND is in
+// flight: Sn_TX_WR is not written until the next w5500_sock_send() or commit sends them.
+void w5500_tx_stage(w5500_tx_t* tx, uint16_t len);
+
+// SEND for everything staged on sn. Only after SENDOK of the previous one.
+void w5500_sock_send(uint8_t sn);
+// Staged bytes on sn still waiting for a SEND
+uint16_t w5500_tx_unsent(uint8_t sn);
+
+// Sn_TX_FSR less staged bytes, read now
+uint16_t w5500_tx_fsr(uint8_t sn);
+
+// Forgets staged bytes, for a socket that is being reopened (OPEN resets the TX pointers)
+void w5500_tx_drop(uint8_t sn);
+
+// Segments back to back as one send (begin, append each, commit - or stage). Returns -1 and
+// leaves the socket alone if Sn_TX_FSR is short for the total.
+int w5500_sock_sendv(uint8_t sn, const w5500_tx_seg_t* segs, uint8_t count, uint8_t stage);
+
+// Starts a DMA read of len bytes from the RX memory of sn (at Sn_RX_RD) into buf and returns
+// without waiting, so the caller can work on what it already has. len must not exceed
+// Sn_RX_RSR. The chip lock is held until w5500_rx_finish(), which must follow in the same task.
+int w5500_rx_start(uint8_t sn, uint8_t* buf, uint16_t len);
+// Waits for the read, then consumes it with one Sn_RX_RD write and one RECV. -1 if it failed,
+// with nothing consumed.
+int w5500_rx_finish(uint8_t sn);
+
+// Consumes len received bytes without reading them (len <= Sn_RX_RSR)
+void w5500_rx_skip(uint8_t sn, uint16_t len);
+
+// Number of sends on sn that found Sn_TX_FSR short and had to wait
+uint32_t w5500_tx_stalls(uint8_t sn);
+
+// Socket bitmask of SIR: sockets with a pending Sn_IR event
+uint8_t w5500_sock_pending(void);
+
+// Reads the status registers of every socket in mask (bit n = socket n) into out[n].
+// One CS frame per socket, all queued back to back under a single W5500 lock.
+int w5500_sock_snapshot(uint8_t mask, w5500_sock_snap_t out[W5500_SOCK_COUNT]);
+
+// Clears the given Sn_IR bits
+void w5500_sock_ack(uint8_t sn, uint8_t ir);
+
+// Sn_IR events that pull INTn low once w5500_irq_attach() has run
+#define W5500_SOCK_IMR (Sn_IR_CON | Sn_IR_DISCON | Sn_IR_RECV | Sn_IR_SENDOK | Sn_IR_TIMEOUT)
+
+// Enables W5500_SOCK_IMR on every socket in mask and routes INTn (GPIOTE) to a task
+// notification (index 0) of task. The task must read SIR down to 0 before it waits again,
+// INTn is only edge-detected. Sn_IMR of the sockets outside mask is left as it is.
+void w5500_irq_attach(uint8_t mask, TaskHandle_t task);
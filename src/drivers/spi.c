@@ -9,73 +9,159 @@
 extern uint8_t __ram_start__;
 extern uint8_t __ram_end__;
 
-static uint8_t scratch_buf[SPI_MAX_XFER];
-static uint8_t tx_staging_buf[SPI_MAX_XFER]; // only used if input tx buf is not in RAM
-
-static SemaphoreHandle_t spi_bus_mutex = NULL; // mutex for exclusive access to the SPI bus
-StaticSemaphore_t spi_bus_mutex_buf;
-static const spi_device_t* active_dev = NULL; // device currently active on the bus
-
-// only one spi master for now
-void spim_init(void) {
+#define SPIM_MAXCNT_MAX 0xFFFFu // TXD/RXD.MAXCNT are 16 bit on nRF52840
+
+// Transaction engine flags
+#define XFER_SESSION (1u << 0) // issued between spi_begin/spi_end: CS and config already set
+
+#define ABORT_NONE 0
+#define ABORT_STOPPING 1 // ISR does not chain while the task stops SPIM
+#define ABORT_FINISH 2	 // ISR completes cur with -1
+
+// Everything one SPIM instance needs. The engine part is owned by the instance's IRQ handler
+// and touched by tasks only inside critical sections.
+typedef struct {
+	NRF_SPIM_Type* regs;
+	IRQn_Type irqn;
+	uint8_t fast; // SPIM3 only: 16/32 MHz, high drive pins, all TX staged (anomaly 198)
+
+	// TX bounce buffers (SPI_STAGING_SIZE each): the IRQ handler fills one while the other is
+	// on the wire
+	uint8_t* tx_staging_buf[2];
+
+	SemaphoreHandle_t bus_mutex; // mutex for exclusive access to the SPI bus
+	StaticSemaphore_t bus_mutex_buf;
+	const spi_device_t* active_dev; // device currently active on the bus
+
+	SemaphoreHandle_t xfer_done; // given when a blocking (session) transfer completes
+	StaticSemaphore_t xfer_done_buf;
+	SemaphoreHandle_t claim_done; // given when the engine hands the bus to spi_begin()
+	StaticSemaphore_t claim_done_buf;
+
+	spi_xfer_t* q_head; // queued descriptors, FIFO
+	spi_xfer_t* q_tail;
+	spi_xfer_t* cur;       // descriptor on the wire
+	uint8_t cur_seg;       // index into cur->segs
+	uint8_t claimed;       // a blocking session owns the bus
+	uint8_t claim_pending; // spi_begin() waits for cur to finish
+	volatile uint8_t abort_state;
+
+	// chunk cursor of the segment on the wire
+	const uint8_t* seg_tx; // NULL: TXD.MAXCNT = 0, SPIM clocks out ORC
+	uint8_t* seg_rx;       // NULL: RXD.MAXCNT = 0, SPIM drops MISO
+	size_t seg_left;       // bytes not yet handed to EasyDMA
+	uint8_t seg_staged;    // seg_tx goes out through tx_staging_buf
+	uint8_t stage_next;    // staging half of the next staged chunk
+	uint8_t stage_ready;   // ... already holding it (copied while the previous chunk ran)
+} spim_ctx_t;
+
+static uint8_t spim0_staging[2][SPI_STAGING_SIZE];
+
+// nRF52840 anomaly 198: SPIM3 TX data can be corrupted when the CPU or another EasyDMA master
+// accesses the RAM block (AHB slave, 8 KB) that holds the TX buffer during the transfer. All
+// SPIM3 TX goes out through these two halves, each alone in its own block (linker.ld), so the
+// IRQ handler can fill one while SPIM3 reads the other. The rest of both blocks stays unused.
+static uint8_t spim3_staging0[SPI_STAGING_SIZE] __attribute__((section(".spim3_tx0")));
+static uint8_t spim3_staging1[SPI_STAGING_SIZE] __attribute__((section(".spim3_tx1")));
+
+static spim_ctx_t spim_ctx[SPI_BUS_COUNT] = {
+	[SPI_BUS_0] = {.regs = SPIM0_REGS,
+		.irqn = SPIM0_IRQn,
+		.fast = 0,
+		.tx_staging_buf = {spim0_staging[0], spim0_staging[1]}},
+	[SPI_BUS_3] = {.regs = SPIM3_REGS,
+		.irqn = SPIM3_IRQn,
+		.fast = 1,
+		.tx_staging_buf = {spim3_staging0, spim3_staging1}},
+};
+
+void spim_init(spi_bus_t bus, const spi_pins_t* pins) {
+	configASSERT(bus < SPI_BUS_COUNT);
+	spim_ctx_t* c = &spim_ctx[bus];
+	NRF_SPIM_Type* spim = c->regs;
+
+	// 16/32 MHz on SPIM3 needs high drive on the clock and data outputs
+	uint32_t drive = c->fast ? (3 << 8) : (0 << 8); // H0H1 : S0S1
 
 	/* ---------------- SCK pin ---------------- */
-	SPIM_PSEL_SCK_REG = (0 << 31) | // CONNECT = 0 → Connected
-			    (0 << 5) |	// PORT = 0 → P0
-			    (SCK_PIN << 0);
+	spim->PSEL.SCK = (0 << 31) | // CONNECT = 0 → Connected
+			 (0 << 5) |  // PORT = 0 → P0
+			 (pins->sck << 0);
 
-	GPIO_CNF(SCK_PIN) = (1 << 0) | // DIR = Output
-			    (1 << 1) | // INPUT = Disconnect
-			    (0 << 2) | // No pull
-			    (0 << 8) | // Standard drive
-			    (0 << 16); // No sense
+	GPIO_CNF(pins->sck) = (1 << 0) | // DIR = Output
+			      (1 << 1) | // INPUT = Disconnect
+			      (0 << 2) | // No pull
+			      drive |	 // Standard / high drive
+			      (0 << 16); // No sense
 
 	/* ---------------- MOSI pin ---------------- */
-	SPIM_PSEL_MOSI_REG = (0 << 31) | (0 << 5) | (MOSI_PIN << 0);
+	spim->PSEL.MOSI = (0 << 31) | (0 << 5) | (pins->mosi << 0);
 
-	GPIO_CNF(MOSI_PIN) = (1 << 0) | // Output
-			     (1 << 1) | // Disconnect input
-			     (0 << 2) | (0 << 8) | (0 << 16);
+	GPIO_CNF(pins->mosi) = (1 << 0) | // Output
+			       (1 << 1) | // Disconnect input
+			       (0 << 2) | drive | (0 << 16);
 
 	/* ---------------- MISO pin ---------------- */
-	SPIM_PSEL_MISO_REG = (0 << 31) | (0 << 5) | (MISO_PIN << 0);
+	spim->PSEL.MISO = (0 << 31) | (0 << 5) | (pins->miso << 0);
 
-	GPIO_CNF(MISO_PIN) = (0 << 0) | // DIR = Input
-			     (0 << 1) | // INPUT = Connected
-			     (0 << 2) | // No pull (depends on slave)
-			     (0 << 8) | (0 << 16);
+	GPIO_CNF(pins->miso) = (0 << 0) | // DIR = Input
+			       (0 << 1) | // INPUT = Connected
+			       (0 << 2) | // No pull (depends on slave)
+			       (0 << 8) | (0 << 16);
 
 	/* --------Set registers to known state ----- */
-	SPIM_CONFIG_REG = (0 << 0) |	 // CPHA = 0
-			  (0 << 1) |	 // CPOL = 0
-			  (0 << 2);	 // ORDER = 0 → MSB first
-	SPIM_FREQUENCY_REG = 0x10000000; // 1 MHz
-	SPIM_ORC_REG = 0xFF;
-
-	SPIM_EVENTS_END_REG = 0;
-	SPIM_EVENTS_STARTED_REG = 0;
-	SPIM_EVENTS_STOPPED_REG = 0;
-
-	SPIM_TXD_PTR_REG = 0;
-	SPIM_TXD_MAXCNT_REG = 0;
-	SPIM_RXD_PTR_REG = 0;
-	SPIM_RXD_MAXCNT_REG = 0;
-	SPIM_SHORTS_REG = 0;
-	SPIM_INTENCLR_REG = 0xFFFFFFFF;
+	spim->CONFIG = (0 << 0) |     // CPHA = 0
+		       (0 << 1) |     // CPOL = 0
+		       (0 << 2);      // ORDER = 0 → MSB first
+	spim->FREQUENCY = 0x10000000; // 1 MHz
+	spim->ORC = 0xFF;
+
+	spim->EVENTS_END = 0;
+	spim->EVENTS_STARTED = 0;
+	spim->EVENTS_STOPPED = 0;
+
+	spim->TXD.PTR = 0;
+	spim->TXD.MAXCNT = 0;
+	spim->RXD.PTR = 0;
+	spim->RXD.MAXCNT = 0;
+	spim->SHORTS = 0;
+	spim->INTENCLR = 0xFFFFFFFF;
 
 	// Create mutex for SPI bus access
-	spi_bus_mutex = xSemaphoreCreateMutexStatic(&spi_bus_mutex_buf);
-	if (spi_bus_mutex == NULL) {
+	c->bus_mutex = xSemaphoreCreateMutexStatic(&c->bus_mutex_buf);
+	if (c->bus_mutex == NULL) {
+		configASSERT(0);
+		for (;;)
+			;
+	}
+
+	// Transfer completion, signalled from the IRQ handler
+	c->xfer_done = xSemaphoreCreateBinaryStatic(&c->xfer_done_buf);
+	c->claim_done = xSemaphoreCreateBinaryStatic(&c->claim_done_buf);
+	if (c->xfer_done == NULL || c->claim_done == NULL) {
 		configASSERT(0);
 		for (;;)
 			;
 	}
 
-	/* ---------------- Enable SPIM0 ---------------- */
-	SPIM_ENABLE_REG = 7;
+	spim->INTENSET = (1 << 6); // END - drives the transaction engine
+
+	NVIC_SetPriority(c->irqn, SPI_IRQ_PRIORITY);
+	NVIC_ClearPendingIRQ(c->irqn);
+	NVIC_EnableIRQ(c->irqn);
+
+	/* ---------------- Enable SPIM ---------------- */
+	spim->ENABLE = 7;
 }
 
 void spi_device_init(const spi_device_t* dev) {
+	configASSERT(dev->bus < SPI_BUS_COUNT);
+
+	// only SPIM3 can clock above 8 MHz
+	if (!spim_ctx[dev->bus].fast) {
+		configASSERT(dev->frequency != SPI_FREQ_16M && dev->frequency != SPI_FREQ_32M);
+	}
+
 	GPIO_CNF(dev->cs_pin) = (1 << 0) | // DIR = 1 → Output
 				(1 << 1) | // INPUT = 1 → Disconnect input buffer
 				(0 << 2) | // PULL = 00 → Disabled
@@ -84,26 +170,33 @@ void spi_device_init(const spi_device_t* dev) {
 	pin_high(dev->cs_pin);
 }
 
-int spi_begin(const spi_device_t* dev) {
+static uint8_t check_buf_in_ram(const uint8_t* buf, size_t len) {
+	uintptr_t ram_lo = (uintptr_t)&__ram_start__;
+	uintptr_t ram_hi = (uintptr_t)&__ram_end__; // exclusive end
 
-	BaseType_t ok = xSemaphoreTake(spi_bus_mutex, portMAX_DELAY);
+	uintptr_t p = (uintptr_t)buf;
 
-	if (ok != pdTRUE) {
-		logger_log_uint_len("SPI BEGIN:",
-			(uint8_t)(sizeof("SPI BEGIN:") - 1),
-			&dev->cs_pin,
-			(uint8_t)sizeof(dev->cs_pin));
+	// Null pointer is never acceptable
+	if (p == 0) {
+		return 0;
+	}
 
-		logger_log_literal_len("SPI BEGIN:",
-			(uint8_t)(sizeof("SPI BEGIN:") - 1),
-			"MUTEX TAKE FAILED",
-			(uint8_t)(sizeof("MUTEX TAKE FAILED") - 1));
+	// For zero-length, require p to be a valid in-range address (not one-past-end)
+	if (len == 0) {
+		return (p >= ram_lo && p < ram_hi) ? 1 : 0;
+	}
 
-		return -1;
+	// Compute end with overflow guard
+	uintptr_t q = p + len;
+	if (q < p) { // overflow
+		return 0;
 	}
 
-	configASSERT(active_dev == NULL);
+	// Range [p, q) must lie within [ram_lo, ram_hi)
+	return (p >= ram_lo && q <= ram_hi) ? 1 : 0;
+}
 
+static void dev_apply(spim_ctx_t* c, const spi_device_t* dev) {
 	uint32_t order = 0;
 	switch (dev->order) {
 	case SPI_MSB_FIRST:
@@ -130,319 +223,533 @@ int spi_begin(const spi_device_t* dev) {
 		cfg = (0 << 0) | (0 << 1) | (order << 2);
 	}
 
-	SPIM_CONFIG_REG = cfg;
-	SPIM_FREQUENCY_REG = dev->frequency;
-	SPIM_ORC_REG = dev->dummy_byte;
+	c->regs->CONFIG = cfg;
+	c->regs->FREQUENCY = dev->frequency;
+	c->regs->ORC = dev->dummy_byte;
 
-	SPIM_EVENTS_END_REG = 0;
-	SPIM_EVENTS_STARTED_REG = 0;
-	SPIM_EVENTS_STOPPED_REG = 0;
+	c->regs->EVENTS_END = 0;
+	c->regs->EVENTS_STARTED = 0;
+	c->regs->EVENTS_STOPPED = 0;
+}
 
-	pin_low(dev->cs_pin);
-	active_dev = dev;
+static TickType_t xfer_timeout_ticks(size_t len) {
+	// wire time at 1 MHz (ceil ms), slower clocks are not used for long transfers
+	uint32_t wire_ms = (uint32_t)((len * 8u + 999u) / 1000u);
 
-	return 0;
+	return SPI_TIMEOUT_TICKS + pdMS_TO_TICKS(wire_ms);
 }
 
-static uint8_t check_buf_in_ram(const uint8_t* buf, size_t len) {
-	uintptr_t ram_lo = (uintptr_t)&__ram_start__;
-	uintptr_t ram_hi = (uintptr_t)&__ram_end__; // exclusive end
+// EasyDMA only reads RAM, anything else goes out through the staging halves. So does all of
+// SPIM3's TX (anomaly 198): a copy of a few hundred bytes is cheap next to a corrupted frame.
+static uint8_t tx_staged(const spim_ctx_t* c, const uint8_t* tx, size_t len) {
+	return tx != NULL && (c->fast || !check_buf_in_ram(tx, len));
+}
 
-	uintptr_t p = (uintptr_t)buf;
+static void seg_begin(spim_ctx_t* c, const spi_seg_t* s) {
+	c->seg_tx = s->tx;
+	c->seg_rx = s->rx;
+	c->seg_left = s->len;
+	c->seg_staged = tx_staged(c, s->tx, s->len);
+}
 
-	// Null pointer is never acceptable
-	if (p == 0) {
-		return 0;
+// Programs the next chunk into TXD/RXD and advances the cursor.
+// A missing side gets MAXCNT = 0: SPIM then clocks ORC (the device's dummy byte) out for
+// reads and drops MISO for writes, so no per-byte CPU work and no scratch memory is needed.
+static void seg_load(spim_ctx_t* c) {
+	size_t n = c->seg_left;
+	const uint8_t* tx = c->seg_tx;
+
+	if (n > SPIM_MAXCNT_MAX)
+		n = SPIM_MAXCNT_MAX;
+
+	if (c->seg_staged) {
+		if (n > SPI_STAGING_SIZE)
+			n = SPI_STAGING_SIZE;
+
+		tx = c->tx_staging_buf[c->stage_next];
+		if (!c->stage_ready)
+			mem_cpy((uint8_t*)tx, c->seg_tx, n); // first staged chunk: nothing prefetched it
+		c->stage_next ^= 1;
+		c->stage_ready = 0;
 	}
 
-	// For zero-length, require p to be a valid in-range address (not one-past-end)
-	if (len == 0) {
-		return (p >= ram_lo && p < ram_hi) ? 1 : 0;
-	}
+	c->regs->TXD.PTR = (uintptr_t)tx;
+	c->regs->TXD.MAXCNT = (tx != NULL) ? n : 0;
+	c->regs->RXD.PTR = (uintptr_t)c->seg_rx;
+	c->regs->RXD.MAXCNT = (c->seg_rx != NULL) ? n : 0;
 
-	// Compute end with overflow guard
-	uintptr_t q = p + len;
-	if (q < p) { // overflow
-		return 0;
+	if (c->seg_tx != NULL)
+		c->seg_tx += n;
+	if (c->seg_rx != NULL)
+		c->seg_rx += n;
+	c->seg_left -= n;
+}
+
+// Right after TASKS_START: copies the chunk that follows into the free staging half, so the
+// copy overlaps the wire time of the chunk just started and the next START has no copy before it
+static void stage_prefetch(spim_ctx_t* c) {
+	const uint8_t* tx = c->seg_tx;
+	size_t left = c->seg_left;
+	uint8_t staged = c->seg_staged;
+
+	if (left == 0) {
+		// the next chunk opens the next segment
+		if (c->cur_seg + 1 >= c->cur->seg_count)
+			return;
+
+		const spi_seg_t* s = &c->cur->segs[c->cur_seg + 1];
+		tx = s->tx;
+		left = s->len;
+		staged = tx_staged(c, tx, left);
 	}
 
-	// Range [p, q) must lie within [ram_lo, ram_hi)
-	return (p >= ram_lo && q <= ram_hi) ? 1 : 0;
+	if (!staged)
+		return;
+
+	mem_cpy(c->tx_staging_buf[c->stage_next], tx,
+		(left < SPI_STAGING_SIZE) ? left : SPI_STAGING_SIZE);
+	c->stage_ready = 1;
 }
 
-// write only
-int spi_tx(const uint8_t* tx_buf, size_t tx_len) {
-	if (active_dev == NULL) {
-		logger_log_literal_len("SPI TX:",
-			(uint8_t)(sizeof("SPI TX:") - 1),
-			"DEV NOT SET",
-			(uint8_t)(sizeof("DEV NOT SET") - 1));
-		configASSERT(0);
-		return -1;
+// Puts x on the wire. Called with the engine idle, from a critical section or the ISR.
+static void engine_run(spim_ctx_t* c, spi_xfer_t* x) {
+	c->cur = x;
+	c->cur_seg = 0;
+
+	if (!(x->flags & XFER_SESSION)) {
+		dev_apply(c, x->dev);
+		pin_low(x->dev->cs_pin);
 	}
 
-	if (tx_len == 0) {
-		logger_log_literal_len("SPI TX:",
-			(uint8_t)(sizeof("SPI TX:") - 1),
-			"NO SEND DATA",
-			(uint8_t)(sizeof("NO SEND DATA") - 1));
-		return -1;
+	c->stage_ready = 0;
+	seg_begin(c, &x->segs[0]);
+	seg_load(c);
+	c->regs->TASKS_START = 1;
+	stage_prefetch(c);
+}
+
+// Starts the next queued descriptor unless a blocking session owns or wants the bus
+static void engine_next(spim_ctx_t* c) {
+	if (c->cur != NULL)
+		return;
+
+	if (c->claim_pending) {
+		// only reached from the ISR: claim_pending is set while cur is busy
+		c->claim_pending = 0;
+		c->claimed = 1;
+
+		BaseType_t woken = pdFALSE;
+		xSemaphoreGiveFromISR(c->claim_done, &woken);
+		portYIELD_FROM_ISR(woken);
+		return;
 	}
 
-	if (tx_len > SPI_MAX_XFER) {
-		logger_log_literal_len("SPI TX:",
-			(uint8_t)(sizeof("SPI TX:") - 1),
-			"DATA LIMIT EXCEED",
-			(uint8_t)(sizeof("DATA LIMIT EXCEED") - 1));
-		configASSERT(0);
-		return -1;
+	if (c->claimed || c->q_head == NULL)
+		return;
+
+	spi_xfer_t* x = c->q_head;
+	c->q_head = x->next;
+	if (c->q_head == NULL)
+		c->q_tail = NULL;
+	x->next = NULL;
+
+	engine_run(c, x);
+}
+
+// Completes cur in interrupt context and moves on to the next descriptor
+static void engine_finish(spim_ctx_t* c, int status) {
+	spi_xfer_t* x = c->cur;
+	c->cur = NULL;
+
+	if (x == NULL)
+		return;
+
+	if (!(x->flags & XFER_SESSION))
+		pin_high(x->dev->cs_pin);
+
+	x->status = status;
+
+	if (x->done != NULL)
+		x->done(x, status);
+
+	if (x->notify != NULL) {
+		BaseType_t woken = pdFALSE;
+		vTaskNotifyGiveIndexedFromISR(x->notify, SPI_NOTIFY_INDEX, &woken);
+		portYIELD_FROM_ISR(woken);
 	}
 
-	if (tx_buf == NULL) {
-		logger_log_literal_len("SPI TX:",
-			(uint8_t)(sizeof("SPI TX:") - 1),
-			"NULL TX BUF",
-			(uint8_t)(sizeof("NULL TX BUF") - 1));
-		configASSERT(0);
-		return -1;
+	engine_next(c);
+}
+
+// Stops a wedged transfer from task context; the ISR then completes it with -1.
+// x: only if x is still the one on the wire, NULL for whichever is.
+static void engine_abort(spim_ctx_t* c, const spi_xfer_t* x) {
+	taskENTER_CRITICAL();
+	uint8_t busy = (c->cur != NULL && (x == NULL || c->cur == x));
+	if (busy)
+		c->abort_state = ABORT_STOPPING;
+	taskEXIT_CRITICAL();
+
+	if (!busy)
+		return;
+
+	c->regs->TASKS_STOP = 1;
+
+	TickType_t stop_start = xTaskGetTickCount();
+	while (c->regs->EVENTS_STOPPED == 0 &&
+		(xTaskGetTickCount() - stop_start) < pdMS_TO_TICKS(5)) {
+		vTaskDelay(1);
 	}
 
-	SPIM_EVENTS_END_REG = 0;
-	SPIM_EVENTS_STARTED_REG = 0;
-	SPIM_EVENTS_STOPPED_REG = 0;
+	taskENTER_CRITICAL();
+	c->regs->EVENTS_END = 0;
+	c->regs->EVENTS_STOPPED = 0;
+	c->regs->EVENTS_STARTED = 0;
 
-	if (check_buf_in_ram(tx_buf, tx_len)) {
-		SPIM_TXD_PTR_REG = (uintptr_t)tx_buf;
-		SPIM_TXD_MAXCNT_REG = tx_len;
-	} else {
-		mem_cpy(tx_staging_buf, tx_buf, tx_len);
-		SPIM_TXD_PTR_REG = (uintptr_t)tx_staging_buf;
-		SPIM_TXD_MAXCNT_REG = tx_len;
+	c->abort_state = ABORT_FINISH;
+	NVIC_SetPendingIRQ(c->irqn);
+	taskEXIT_CRITICAL();
+}
+
+static void spim_irq(spim_ctx_t* c) {
+	if (c->abort_state == ABORT_FINISH) {
+		c->abort_state = ABORT_NONE;
+		engine_finish(c, -1);
+		return;
 	}
 
-	// Full duplex: always clock RX into scratch
-	SPIM_RXD_PTR_REG = (uintptr_t)scratch_buf;
-	SPIM_RXD_MAXCNT_REG = tx_len;
+	if (c->regs->EVENTS_END == 0)
+		return;
+
+	c->regs->EVENTS_END = 0;
+	(void)c->regs->EVENTS_END; // flush the write before returning from the ISR
 
-	SPIM_TASKS_START_REG = 1;
+	// being stopped by engine_abort(): do not chain, the abort completes cur
+	if (c->abort_state == ABORT_STOPPING || c->cur == NULL)
+		return;
 
-	TickType_t start_tick = xTaskGetTickCount();
+	if (c->seg_left == 0 && ++c->cur_seg < c->cur->seg_count)
+		seg_begin(c, &c->cur->segs[c->cur_seg]);
 
-	while (SPIM_EVENTS_END_REG == 0 && (xTaskGetTickCount() - start_tick) < SPI_TIMEOUT_TICKS) {
-		vTaskDelay(0);
+	if (c->seg_left > 0) {
+		// chain the next chunk - CS stays asserted, nobody gets woken up
+		seg_load(c);
+		c->regs->TASKS_START = 1;
+		stage_prefetch(c);
+		return;
 	}
 
-	if (SPIM_EVENTS_END_REG == 0) {
-		SPIM_TASKS_STOP_REG = 1;
+	engine_finish(c, 0);
+}
 
-		TickType_t stop_start = xTaskGetTickCount();
-		while (SPIM_EVENTS_STOPPED_REG == 0 &&
-			(xTaskGetTickCount() - stop_start) < pdMS_TO_TICKS(5)) {
-			vTaskDelay(1);
-		}
+void SPIM0_IRQHandler(void) {
+	spim_irq(&spim_ctx[SPI_BUS_0]);
+}
+
+void SPIM3_IRQHandler(void) {
+	spim_irq(&spim_ctx[SPI_BUS_3]);
+}
+
+static uint8_t seg_valid(const spi_seg_t* s) {
+	if (s->len == 0 || (s->tx == NULL && s->rx == NULL))
+		return 0;
 
-		SPIM_EVENTS_END_REG = 0;
-		SPIM_EVENTS_STOPPED_REG = 0;
-		SPIM_EVENTS_STARTED_REG = 0;
+	if (s->rx != NULL && !check_buf_in_ram(s->rx, s->len))
+		return 0;
 
-		logger_log_literal_len("SPI TX:",
-			(uint8_t)(sizeof("SPI TX:") - 1),
-			"TIMEOUT",
-			(uint8_t)(sizeof("TIMEOUT") - 1));
+	return 1;
+}
 
+int spi_submit(spi_xfer_t* xfer) {
+	if (xfer == NULL || xfer->dev == NULL || xfer->segs == NULL || xfer->seg_count == 0)
 		return -1;
+
+	if (xfer->dev->bus >= SPI_BUS_COUNT)
+		return -1;
+
+	for (uint8_t i = 0; i < xfer->seg_count; i++) {
+		if (!seg_valid(&xfer->segs[i]))
+			return -1;
 	}
 
+	spim_ctx_t* c = &spim_ctx[xfer->dev->bus];
+
+	xfer->status = SPI_XFER_PENDING;
+	xfer->flags = 0;
+	xfer->next = NULL;
+
+	// also called from completion callbacks to chain the next transaction
+	uint8_t in_isr = (xPortIsInsideInterrupt() == pdTRUE);
+	UBaseType_t saved = 0;
+	if (in_isr)
+		saved = taskENTER_CRITICAL_FROM_ISR();
+	else
+		taskENTER_CRITICAL();
+
+	if (c->q_tail != NULL)
+		c->q_tail->next = xfer;
+	else
+		c->q_head = xfer;
+	c->q_tail = xfer;
+
+	engine_next(c);
+
+	if (in_isr)
+		taskEXIT_CRITICAL_FROM_ISR(saved);
+	else
+		taskEXIT_CRITICAL();
+
 	return 0;
 }
 
-// read only
-int spi_rx(uint8_t* rx_buf, size_t rx_len) {
-	if (active_dev == NULL) {
-		logger_log_literal_len("SPI RX:",
-			(uint8_t)(sizeof("SPI RX:") - 1),
-			"DEV NOT SET",
-			(uint8_t)(sizeof("DEV NOT SET") - 1));
-		configASSERT(0);
-		return -1;
+int spi_cancel(spi_xfer_t* xfer) {
+	if (xfer->status != SPI_XFER_PENDING)
+		return xfer->status;
+
+	spim_ctx_t* c = &spim_ctx[xfer->dev->bus];
+
+	taskENTER_CRITICAL();
+	// whatever happens now, the owner has stopped listening
+	xfer->done = NULL;
+	xfer->notify = NULL;
+
+	uint8_t on_wire = (c->cur == xfer);
+	if (!on_wire && xfer->status == SPI_XFER_PENDING) {
+		// still queued: unlink it, the engine never sees it
+		spi_xfer_t* prev = NULL;
+		for (spi_xfer_t* q = c->q_head; q != NULL; prev = q, q = q->next) {
+			if (q != xfer)
+				continue;
+
+			if (prev != NULL)
+				prev->next = q->next;
+			else
+				c->q_head = q->next;
+			if (c->q_tail == q)
+				c->q_tail = prev;
+			break;
+		}
+		xfer->next = NULL;
+		xfer->status = -1;
 	}
+	taskEXIT_CRITICAL();
 
-	if (rx_len == 0) {
-		logger_log_literal_len("SPI RX:",
-			(uint8_t)(sizeof("SPI RX:") - 1),
-			"NO RECEIVE DATA",
-			(uint8_t)(sizeof("NO RECEIVE DATA") - 1));
-		return -1;
+	if (on_wire) {
+		// the pended IRQ completes it with -1 as soon as the critical section is left
+		engine_abort(c, xfer);
+		configASSERT(xfer->status != SPI_XFER_PENDING);
 	}
 
-	if (rx_len > SPI_MAX_XFER) {
-		logger_log_literal_len("SPI RX:",
-			(uint8_t)(sizeof("SPI RX:") - 1),
-			"DATA LIMIT EXCEED",
-			(uint8_t)(sizeof("DATA LIMIT EXCEED") - 1));
-		configASSERT(0);
-		return -1;
-	}
+	return xfer->status;
+}
+
+int spi_begin(const spi_device_t* dev) {
+	spim_ctx_t* c = &spim_ctx[dev->bus];
+
+	BaseType_t ok = xSemaphoreTake(c->bus_mutex, portMAX_DELAY);
+
+	if (ok != pdTRUE) {
+		LOG_VALUE(LOG_LEVEL_ERROR, LOG_MOD_SPI, "SPI BEGIN:", &dev->cs_pin);
+
+		LOG_TEXT(LOG_LEVEL_ERROR, LOG_MOD_SPI, "SPI BEGIN:", "MUTEX TAKE FAILED");
 
-	if (rx_buf == NULL) {
-		logger_log_literal_len("SPI RX:",
-			(uint8_t)(sizeof("SPI RX:") - 1),
-			"NULL RX BUF",
-			(uint8_t)(sizeof("NULL RX BUF") - 1));
-		configASSERT(0);
 		return -1;
 	}
-	if (!check_buf_in_ram(rx_buf, rx_len)) {
-		logger_log_literal_len("SPI RX:",
-			(uint8_t)(sizeof("SPI RX:") - 1),
-			"RX BUF NOT IN RAM",
-			(uint8_t)(sizeof("RX BUF NOT IN RAM") - 1));
-		configASSERT(0);
-		return -1;
+
+	configASSERT(c->active_dev == NULL);
+
+	// Wait for the queued/async work on the wire to finish, then keep the engine to ourselves
+	uint8_t granted = 0;
+	taskENTER_CRITICAL();
+	if (c->cur == NULL && !c->claimed) {
+		c->claimed = 1;
+		granted = 1;
+	} else {
+		c->claim_pending = 1;
 	}
+	taskEXIT_CRITICAL();
 
-	SPIM_EVENTS_END_REG = 0;
-	SPIM_EVENTS_STARTED_REG = 0;
-	SPIM_EVENTS_STOPPED_REG = 0;
+	if (!granted &&
+		xSemaphoreTake(c->claim_done, xfer_timeout_ticks(SPIM_MAXCNT_MAX)) != pdTRUE) {
+		LOG_TEXT(LOG_LEVEL_ERROR, LOG_MOD_SPI, "SPI BEGIN:", "ASYNC TIMEOUT");
 
-	size_t i = 0;
-	while (i < rx_len) {
-		scratch_buf[i++] = active_dev->dummy_byte;
+		// the aborted descriptor completes with -1 and the engine grants the claim
+		engine_abort(c, NULL);
+		ok = xSemaphoreTake(c->claim_done, pdMS_TO_TICKS(5));
+		configASSERT(ok == pdTRUE);
 	}
 
-	SPIM_TXD_PTR_REG = (uintptr_t)scratch_buf;
-	SPIM_TXD_MAXCNT_REG = rx_len;
+	dev_apply(c, dev);
 
-	SPIM_RXD_PTR_REG = (uintptr_t)rx_buf;
-	SPIM_RXD_MAXCNT_REG = rx_len;
+	pin_low(dev->cs_pin);
+	c->active_dev = dev;
 
-	SPIM_TASKS_START_REG = 1;
+	return 0;
+}
 
-	TickType_t start_tick = xTaskGetTickCount();
+static void session_done(spi_xfer_t* x, int status) {
+	(void)status;
 
-	while (SPIM_EVENTS_END_REG == 0 && (xTaskGetTickCount() - start_tick) < SPI_TIMEOUT_TICKS) {
-		vTaskDelay(0);
-	}
+	spim_ctx_t* c = &spim_ctx[x->dev->bus];
 
-	if (SPIM_EVENTS_END_REG == 0) {
-		SPIM_TASKS_STOP_REG = 1;
+	BaseType_t woken = pdFALSE;
+	xSemaphoreGiveFromISR(c->xfer_done, &woken);
+	portYIELD_FROM_ISR(woken);
+}
 
-		TickType_t stop_start = xTaskGetTickCount();
-		while (SPIM_EVENTS_STOPPED_REG == 0 &&
-			(xTaskGetTickCount() - stop_start) < pdMS_TO_TICKS(5)) {
-			vTaskDelay(1);
-		}
+// Puts one session descriptor on the wire. The bus is claimed, so the engine is idle and x goes
+// straight out. s and x must stay alive until session_wait() returns.
+static void session_start(spim_ctx_t* c,
+	spi_xfer_t* x,
+	spi_seg_t* s,
+	const uint8_t* tx,
+	uint8_t* rx,
+	size_t len) {
+	s->tx = tx;
+	s->rx = rx;
+	s->len = len;
+
+	mem_set(x, 0, sizeof(*x));
+	x->dev = c->active_dev;
+	x->segs = s;
+	x->seg_count = 1;
+	x->done = session_done;
+	x->status = SPI_XFER_PENDING;
+	x->flags = XFER_SESSION;
+
+	// drop a completion left over from an earlier transfer that timed out
+	(void)xSemaphoreTake(c->xfer_done, 0);
+
+	taskENTER_CRITICAL();
+	engine_run(c, x);
+	taskEXIT_CRITICAL();
+}
 
-		SPIM_EVENTS_END_REG = 0;
-		SPIM_EVENTS_STOPPED_REG = 0;
-		SPIM_EVENTS_STARTED_REG = 0;
+// Sleeps until x completes, aborting it if it wedges
+static int session_wait(spim_ctx_t* c, spi_xfer_t* x, size_t len) {
+	if (xSemaphoreTake(c->xfer_done, xfer_timeout_ticks(len)) == pdTRUE)
+		return x->status;
 
-		logger_log_literal_len("SPI RX:",
-			(uint8_t)(sizeof("SPI RX:") - 1),
-			"TIMEOUT",
-			(uint8_t)(sizeof("TIMEOUT") - 1));
+	engine_abort(c, x);
 
-		return -1;
-	}
+	// x lives on the caller's stack - wait until the ISR is done with it
+	BaseType_t ok = xSemaphoreTake(c->xfer_done, pdMS_TO_TICKS(5));
+	configASSERT(ok == pdTRUE);
 
-	return 0;
+	return x->status;
 }
 
-// read-write
-int spi_txrx(const uint8_t* tx_buf, uint8_t* rx_buf, size_t len) {
-	if (active_dev == NULL) {
-		logger_log_literal_len("SPI TXRX:",
-			(uint8_t)(sizeof("SPI TXRX:") - 1),
-			"DEV NOT SET",
-			(uint8_t)(sizeof("DEV NOT SET") - 1));
+// Blocking transfer inside the spi_begin/spi_end window: one engine descriptor, waited on here.
+// The caller sleeps for the whole transfer instead of polling; a tx the engine has to stage
+// (flash) is still one descriptor and one wakeup, the chunks are chained from the IRQ handler.
+static int xfer_run(spim_ctx_t* c, const uint8_t* tx, uint8_t* rx, size_t len) {
+	spi_seg_t s;
+	spi_xfer_t x;
+
+	session_start(c, &x, &s, tx, rx, len);
+	return session_wait(c, &x, len);
+}
+
+// write only
+int spi_tx(const spi_device_t* dev, const uint8_t* tx_buf, size_t tx_len) {
+	spim_ctx_t* c = &spim_ctx[dev->bus];
+
+	if (c->active_dev != dev) {
+		LOG_TEXT(LOG_LEVEL_ERROR, LOG_MOD_SPI, "SPI TX:", "DEV NOT SET");
 		configASSERT(0);
 		return -1;
 	}
 
-	if (len == 0) {
-		logger_log_literal_len("SPI TXRX:",
-			(uint8_t)(sizeof("SPI TXRX:") - 1),
-			"NO SEND DATA",
-			(uint8_t)(sizeof("NO SEND DATA") - 1));
+	if (tx_len == 0) {
+		LOG_TEXT(LOG_LEVEL_ERROR, LOG_MOD_SPI, "SPI TX:", "NO SEND DATA");
 		return -1;
 	}
 
-	if (len > SPI_MAX_XFER) {
-		logger_log_literal_len("SPI TXRX:",
-			(uint8_t)(sizeof("SPI TXRX:") - 1),
-			"DATA LIMIT EXCEED",
-			(uint8_t)(sizeof("DATA LIMIT EXCEED") - 1));
+	if (tx_buf == NULL) {
+		LOG_TEXT(LOG_LEVEL_ERROR, LOG_MOD_SPI, "SPI TX:", "NULL TX BUF");
 		configASSERT(0);
 		return -1;
 	}
 
-	if (tx_buf == NULL) {
-		logger_log_literal_len("SPI TXRX:",
-			(uint8_t)(sizeof("SPI TXRX:") - 1),
-			"NULL TX BUF",
-			(uint8_t)(sizeof("NULL TX BUF") - 1));
+	// write only: RXD.MAXCNT = 0, MISO is not stored anywhere
+	if (xfer_run(c, tx_buf, NULL, tx_len) != 0) {
+		LOG_TEXT(LOG_LEVEL_ERROR, LOG_MOD_SPI, "SPI TX:", "TIMEOUT");
+
+		return -1;
+	}
+
+	return 0;
+}
+
+// read only
+int spi_rx(const spi_device_t* dev, uint8_t* rx_buf, size_t rx_len) {
+	spim_ctx_t* c = &spim_ctx[dev->bus];
+
+	if (c->active_dev != dev) {
+		LOG_TEXT(LOG_LEVEL_ERROR, LOG_MOD_SPI, "SPI RX:", "DEV NOT SET");
 		configASSERT(0);
 		return -1;
 	}
 
+	if (rx_len == 0) {
+		LOG_TEXT(LOG_LEVEL_ERROR, LOG_MOD_SPI, "SPI RX:", "NO RECEIVE DATA");
+		return -1;
+	}
+
 	if (rx_buf == NULL) {
-		logger_log_literal_len("SPI TXRX:",
-			(uint8_t)(sizeof("SPI TXRX:") - 1),
-			"NULL RX BUF",
-			(uint8_t)(sizeof("NULL RX BUF") - 1));
+		LOG_TEXT(LOG_LEVEL_ERROR, LOG_MOD_SPI, "SPI RX:", "NULL RX BUF");
 		configASSERT(0);
 		return -1;
 	}
-	if (!check_buf_in_ram(rx_buf, len)) {
-		logger_log_literal_len("SPI TXRX:",
-			(uint8_t)(sizeof("SPI TXRX:") - 1),
-			"RX BUF NOT IN RAM",
-			(uint8_t)(sizeof("RX BUF NOT IN RAM") - 1));
+	if (!check_buf_in_ram(rx_buf, rx_len)) {
+		LOG_TEXT(LOG_LEVEL_ERROR, LOG_MOD_SPI, "SPI RX:", "RX BUF NOT IN RAM");
 		configASSERT(0);
 		return -1;
 	}
 
-	SPIM_EVENTS_END_REG = 0;
-	SPIM_EVENTS_STARTED_REG = 0;
-	SPIM_EVENTS_STOPPED_REG = 0;
+	if (xfer_run(c, NULL, rx_buf, rx_len) != 0) {
+		LOG_TEXT(LOG_LEVEL_ERROR, LOG_MOD_SPI, "SPI RX:", "TIMEOUT");
 
-	if (check_buf_in_ram(tx_buf, len)) {
-		SPIM_TXD_PTR_REG = (uintptr_t)tx_buf;
-		SPIM_TXD_MAXCNT_REG = len;
-	} else {
-		mem_cpy(tx_staging_buf, tx_buf, len);
-		SPIM_TXD_PTR_REG = (uintptr_t)tx_staging_buf;
-		SPIM_TXD_MAXCNT_REG = len;
+		return -1;
 	}
 
-	SPIM_RXD_PTR_REG = (uintptr_t)rx_buf;
-	SPIM_RXD_MAXCNT_REG = len;
-
-	SPIM_TASKS_START_REG = 1;
+	return 0;
+}
 
-	TickType_t start_tick = xTaskGetTickCount();
+// read-write
+int spi_txrx(const spi_device_t* dev, const uint8_t* tx_buf, uint8_t* rx_buf, size_t len) {
+	spim_ctx_t* c = &spim_ctx[dev->bus];
 
-	while (SPIM_EVENTS_END_REG == 0 && (xTaskGetTickCount() - start_tick) < SPI_TIMEOUT_TICKS) {
-		vTaskDelay(0);
+	if (c->active_dev != dev) {
+		LOG_TEXT(LOG_LEVEL_ERROR, LOG_MOD_SPI, "SPI TXRX:", "DEV NOT SET");
+		configASSERT(0);
+		return -1;
 	}
 
-	if (SPIM_EVENTS_END_REG == 0) {
-		SPIM_TASKS_STOP_REG = 1;
+	if (len == 0) {
+		LOG_TEXT(LOG_LEVEL_ERROR, LOG_MOD_SPI, "SPI TXRX:", "NO SEND DATA");
+		return -1;
+	}
 
-		TickType_t stop_start = xTaskGetTickCount();
-		while (SPIM_EVENTS_STOPPED_REG == 0 &&
-			(xTaskGetTickCount() - stop_start) < pdMS_TO_TICKS(5)) {
-			vTaskDelay(1);
-		}
+	if (tx_buf == NULL) {
+		LOG_TEXT(LOG_LEVEL_ERROR, LOG_MOD_SPI, "SPI TXRX:", "NULL TX BUF");
+		configASSERT(0);
+		return -1;
+	}
 
-		SPIM_EVENTS_END_REG = 0;
-		SPIM_EVENTS_STOPPED_REG = 0;
-		SPIM_EVENTS_STARTED_REG = 0;
+	if (rx_buf == NULL) {
+		LOG_TEXT(LOG_LEVEL_ERROR, LOG_MOD_SPI, "SPI TXRX:", "NULL RX BUF");
+		configASSERT(0);
+		return -1;
+	}
+	if (!check_buf_in_ram(rx_buf, len)) {
+		LOG_TEXT(LOG_LEVEL_ERROR, LOG_MOD_SPI, "SPI TXRX:", "RX BUF NOT IN RAM");
+		configASSERT(0);
+		return -1;
+	}
 
-		logger_log_literal_len("SPI TXRX:",
-			(uint8_t)(sizeof("SPI TXRX:") - 1),
-			"TIMEOUT",
-			(uint8_t)(sizeof("TIMEOUT") - 1));
+	if (xfer_run(c, tx_buf, rx_buf, len) != 0) {
+		LOG_TEXT(LOG_LEVEL_ERROR, LOG_MOD_SPI, "SPI TXRX:", "TIMEOUT");
 
 		return -1;
 	}
@@ -450,13 +757,21 @@ int spi_txrx(const uint8_t* tx_buf, uint8_t* rx_buf, size_t len) {
 	return 0;
 }
 
-int spi_end(void) {
-	if (active_dev == NULL)
+int spi_end(const spi_device_t* dev) {
+	spim_ctx_t* c = &spim_ctx[dev->bus];
+
+	if (c->active_dev != dev)
 		return -1;
 
-	pin_high(active_dev->cs_pin);
-	active_dev = NULL;
+	pin_high(dev->cs_pin);
+	c->active_dev = NULL;
+
+	// let queued async descriptors run again
+	taskENTER_CRITICAL();
+	c->claimed = 0;
+	engine_next(c);
+	taskEXIT_CRITICAL();
 
-	xSemaphoreGive(spi_bus_mutex);
+	xSemaphoreGive(c->bus_mutex);
 	return 0;
 }
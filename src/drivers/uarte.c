@@ -4,7 +4,12 @@
 #include "semphr.h"
 
 // Static - RAM allocation, no dynamic memory management needed
-static uint8_t tx_buf[UART_TX_BUF_SIZE];
+static uint8_t tx_bufs[2][UART_TX_BUF_SIZE];
+static uint8_t fill_idx;	// buffer being packed, the other one may be on the wire
+static size_t fill_len;
+static volatile uint8_t tx_busy; // DMA in flight, cleared by the ENDTX interrupt
+static SemaphoreHandle_t tx_done = NULL;
+static StaticSemaphore_t tx_done_buf;
 static SemaphoreHandle_t uarte_mutex = NULL;
 
 static TickType_t tx_timeout_ticks(size_t bytes) {
@@ -27,35 +32,52 @@ static TickType_t tx_timeout_ticks(size_t bytes) {
 	return pdMS_TO_TICKS(timeout_ms);
 }
 
-static uint8_t tx_send_blocking(const uint8_t* tx, size_t len) {
-	if (len == 0)
-		return 1; // Nothing to send
-	if (len > 0xFFFF)
-		len = 0xFFFF; // MAXCNT is 16-bit
+void UARTE_IRQHandler(void) {
+	if (UARTE_EVENTS_ENDTX_REG == 0)
+		return;
 
-	// Clear completion event
 	UARTE_EVENTS_ENDTX_REG = 0;
+	(void)UARTE_EVENTS_ENDTX_REG; // flush the clear before returning
 
-	// Program EasyDMA
-	UARTE_TXD_PTR_REG = (uint32_t)(uintptr_t)tx;
-	UARTE_TXD_MAXCNT_REG = (uint32_t)len;
+	tx_busy = 0;
 
-	// Start TX
-	UARTE_TASKS_STARTTX_REG = 1;
-
-	TickType_t start = xTaskGetTickCount();
-	TickType_t timeout = tx_timeout_ticks(len);
+	BaseType_t woken = pdFALSE;
+	xSemaphoreGiveFromISR(tx_done, &woken);
+	portYIELD_FROM_ISR(woken);
+}
 
-	// Wait for completion (DMA done)
-	while (UARTE_EVENTS_ENDTX_REG == 0) {
-		if ((xTaskGetTickCount() - start) > timeout) {
+// Sleeps until the buffer on the wire is done. 0 if it never finished (the UARTE is reset).
+static uint8_t tx_wait_idle(void) {
+	while (tx_busy) {
+		// tx_done may hold a give from an earlier transfer - tx_busy is what counts
+		if (xSemaphoreTake(tx_done, tx_timeout_ticks(UART_TX_BUF_SIZE)) != pdTRUE && tx_busy) {
 			uarte_recover();
 			return 0; // Timeout, consider it a failure
 		}
-		taskYIELD();
 	}
 
-	return 1; // Success
+	return 1;
+}
+
+// Puts the packed buffer on the wire and switches packing to the other one
+static uint8_t tx_start_fill(void) {
+	if (fill_len == 0)
+		return 1; // Nothing to send
+
+	uint8_t ok = tx_wait_idle();
+
+	tx_busy = 1;
+
+	// Program EasyDMA
+	UARTE_TXD_PTR_REG = (uint32_t)(uintptr_t)tx_bufs[fill_idx];
+	UARTE_TXD_MAXCNT_REG = (uint32_t)fill_len;
+
+	// Start TX, ENDTX interrupts when the last byte is out of RAM
+	UARTE_TASKS_STARTTX_REG = 1;
+
+	fill_idx ^= 1u;
+	fill_len = 0;
+	return ok;
 }
 
 void uarte_init(void) {
@@ -81,8 +103,18 @@ void uarte_init(void) {
 	UARTE_EVENTS_ENDTX_REG = 0;
 	UARTE_EVENTS_TXSTOPPED_REG = 0;
 
-	UARTE_ENABLE_REG = 8; // Enable UARTE
+	fill_idx = 0;
+	fill_len = 0;
+	tx_busy = 0;
+	tx_done = xSemaphoreCreateBinaryStatic(&tx_done_buf);
 	uarte_mutex = xSemaphoreCreateMutex();
+
+	UARTE_INTENSET_REG = (1u << 8); // ENDTX
+	NVIC_SetPriority(UARTE_IRQn, UART_IRQ_PRIORITY);
+	NVIC_ClearPendingIRQ(UARTE_IRQn);
+	NVIC_EnableIRQ(UARTE_IRQn);
+
+	UARTE_ENABLE_REG = 8; // Enable UARTE
 }
 
 void uarte_recover(void) {
@@ -100,28 +132,56 @@ void uarte_recover(void) {
 	// clear events and reset state
 	UARTE_EVENTS_ENDTX_REG = 0;
 	UARTE_EVENTS_TXSTOPPED_REG = 0;
+	tx_busy = 0;
 
 	UARTE_ENABLE_REG = 8; // Enable UARTE
 }
 
 // To only be used by the logging lib
-uint8_t uarte_write(const uint8_t* data, size_t len) {
+uint8_t uarte_append(const uint8_t* data, size_t len) {
 	if (data == NULL)
 		return 0;
 
 	if (uarte_mutex)
 		xSemaphoreTake(uarte_mutex, portMAX_DELAY);
 
-	if (len > sizeof(tx_buf))
-		len = sizeof(tx_buf);
+	uint8_t ok = 1;
+	while (len > 0) {
+		size_t n = UART_TX_BUF_SIZE - fill_len;
+		if (n > len)
+			n = len;
+
+		uint8_t* dst = &tx_bufs[fill_idx][fill_len];
+		for (size_t i = 0; i < n; i++)
+			dst[i] = data[i];
+
+		fill_len += n;
+		data += n;
+		len -= n;
+
+		if (fill_len == UART_TX_BUF_SIZE)
+			ok &= tx_start_fill();
+	}
+
+	if (uarte_mutex)
+		xSemaphoreGive(uarte_mutex);
+
+	return ok;
+}
 
-	for (size_t i = 0; i < len; i++)
-		tx_buf[i] = data[i];
+uint8_t uarte_flush(void) {
+	if (uarte_mutex)
+		xSemaphoreTake(uarte_mutex, portMAX_DELAY);
 
-	uint8_t ok = tx_send_blocking(tx_buf, len);
+	uint8_t ok = tx_start_fill();
 
 	if (uarte_mutex)
 		xSemaphoreGive(uarte_mutex);
 
 	return ok;
 }
+
+uint8_t uarte_write(const uint8_t* data, size_t len) {
+	uint8_t ok = uarte_append(data, len);
+	return uarte_flush() && ok;
+}
@@ -1,4 +1,5 @@
 #include "FreeRTOS.h" // IWYU pragma: keep
+#include "board.h"
 #include "drivers/spi.h"
 #include "modules/logger.h"
 #include "modules/net.h"
@@ -16,7 +17,8 @@ static void startup_task(void* arg) {
 
 int main(void) {
 	// Baremetal initialization
-	spim_init();
+	static const spi_pins_t spi_pins = {.sck = SCK_PIN, .mosi = MOSI_PIN, .miso = MISO_PIN};
+	spim_init(SPI_BUS_3, &spi_pins);
 
 	BaseType_t ok = xTaskCreate(startup_task, /* Task function */
 		"startup",			  /* Name (for debug) */
@@ -11,6 +11,23 @@ void* mem_cpy(void* dest, const void* src, size_t n) {
 	return dest;
 }
 
+void* mem_move(void* dest, const void* src, size_t n) {
+	uint8_t* d = (uint8_t*)dest;
+	const uint8_t* s = (const uint8_t*)src;
+
+	if (d < s) {
+		while (n--) {
+			*d++ = *s++;
+		}
+	} else {
+		while (n--) {
+			d[n] = s[n];
+		}
+	}
+
+	return dest;
+}
+
 void* mem_set(void* s, int c, size_t n) {
 	uint8_t* p = (uint8_t*)s;
 
@@ -0,0 +1,382 @@
+#include "modules/http.h"
+#include "memutils.h"
+
+enum {
+	ST_METHOD,
+	ST_LEAD_LF,   // after the CR of an empty line before the request line
+	ST_TARGET,
+	ST_VERSION,
+	ST_LINE_LF,   // after the request line CR
+	ST_NAME_START,
+	ST_NAME,
+	ST_VALUE_WS,  // leading whitespace of a value
+	ST_VALUE,
+	ST_VALUE_LF,  // after a header line CR
+	ST_END_LF,    // after the CR of the blank line
+	ST_DONE,
+};
+
+static const struct {
+	const char* name;
+	uint8_t len;
+} hdr_names[HTTP_HDR_COUNT] = {
+	[HTTP_HDR_HOST] = {"host", 4},
+	[HTTP_HDR_CONNECTION] = {"connection", 10},
+	[HTTP_HDR_CONTENT_LENGTH] = {"content-length", 14},
+	[HTTP_HDR_IF_NONE_MATCH] = {"if-none-match", 13},
+	[HTTP_HDR_RANGE] = {"range", 5},
+	[HTTP_HDR_ACCEPT_ENCODING] = {"accept-encoding", 15},
+	[HTTP_HDR_TRANSFER_ENCODING] = {"transfer-encoding", 17},
+};
+
+static uint8_t lower(uint8_t c) {
+	return (c >= 'A' && c <= 'Z') ? (uint8_t)(c + ('a' - 'A')) : c;
+}
+
+// RFC 9110 tchar
+static int is_tchar(uint8_t c) {
+	if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9'))
+		return 1;
+
+	switch (c) {
+	case '!':
+	case '#':
+	case '$':
+	case '%':
+	case '&':
+	case '\'':
+	case '*':
+	case '+':
+	case '-':
+	case '.':
+	case '^':
+	case '_':
+	case '`':
+	case '|':
+	case '~':
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+static int is_ws(uint8_t c) {
+	return c == ' ' || c == '\t';
+}
+
+static int lit_eq(const uint8_t* p, uint16_t len, const char* lit, uint16_t lit_len) {
+	return len == lit_len && mem_cmp(p, lit, len) == 0;
+}
+
+static http_method_t method_of(const uint8_t* p, uint16_t len) {
+	if (lit_eq(p, len, "GET", 3))
+		return HTTP_METHOD_GET;
+	if (lit_eq(p, len, "HEAD", 4))
+		return HTTP_METHOD_HEAD;
+	if (lit_eq(p, len, "POST", 4))
+		return HTTP_METHOD_POST;
+	return HTTP_METHOD_OTHER;
+}
+
+static uint8_t hdr_of(const uint8_t* p, uint16_t len) {
+	for (uint8_t h = 0; h < HTTP_HDR_COUNT; h++) {
+		if (hdr_names[h].len != len)
+			continue;
+
+		uint16_t i = 0;
+		while (i < len && lower(p[i]) == (uint8_t)hdr_names[h].name[i])
+			i++;
+
+		if (i == len)
+			return h;
+	}
+
+	return HTTP_HDR_COUNT;
+}
+
+// 1*DIGIT, no sign, no overflow
+static int parse_u32(const uint8_t* p, uint16_t len, uint32_t* out) {
+	if (len == 0)
+		return -1;
+
+	uint32_t v = 0;
+	for (uint16_t i = 0; i < len; i++) {
+		if (p[i] < '0' || p[i] > '9')
+			return -1;
+		if (v > (UINT32_MAX - 9) / 10)
+			return -1;
+		v = v * 10 + (uint32_t)(p[i] - '0');
+	}
+
+	*out = v;
+	return 0;
+}
+
+static int store_hdr(http_req_t* req, const uint8_t* buf) {
+	if (req->hdr == HTTP_HDR_COUNT)
+		return 0;
+
+	http_slice_t v = {req->tok, (uint16_t)(req->trail - req->tok)};
+
+	if (req->hdr == HTTP_HDR_CONTENT_LENGTH) {
+		uint32_t n;
+		// a second Content-Length could frame the body differently - refuse
+		if (http_has(req, HTTP_HDR_CONTENT_LENGTH) || parse_u32(buf + v.off, v.len, &n) != 0)
+			return -1;
+		req->content_length = n;
+	}
+
+	// repeated headers keep the first value
+	if (!http_has(req, (http_hdr_t)req->hdr)) {
+		req->hdrs[req->hdr] = v;
+		req->hdr_seen |= (uint8_t)(1u << req->hdr);
+	}
+
+	return 0;
+}
+
+// req->pos is on the final LF
+static http_parse_rc_t head_done(http_req_t* req) {
+	req->pos++;
+	req->head_len = req->pos;
+	req->state = ST_DONE;
+
+	if (http_has(req, HTTP_HDR_TRANSFER_ENCODING))
+		return HTTP_PARSE_ERROR;
+
+	req->body_left = req->content_length;
+	return HTTP_PARSE_DONE;
+}
+
+void http_req_init(http_req_t* req) {
+	mem_set(req, 0, sizeof(*req));
+	req->state = ST_METHOD;
+}
+
+http_parse_rc_t http_parse(http_req_t* req, const uint8_t* buf, uint16_t len) {
+	if (req->state == ST_DONE)
+		return HTTP_PARSE_DONE;
+
+	for (; req->pos < len; req->pos++) {
+		uint16_t pos = req->pos;
+		uint8_t c = buf[pos];
+
+		switch (req->state) {
+		case ST_METHOD:
+			if (c == '\r' && pos == req->tok) {
+				// RFC 9112 2.2: empty lines before the request line are skipped, some
+				// clients send a CRLF after a POST body
+				req->state = ST_LEAD_LF;
+			} else if (c == ' ' && pos > req->tok) {
+				req->method = method_of(buf + req->tok, (uint16_t)(pos - req->tok));
+				req->tok = (uint16_t)(pos + 1);
+				req->state = ST_TARGET;
+			} else if (!is_tchar(c)) {
+				return HTTP_PARSE_ERROR;
+			}
+			break;
+
+		case ST_LEAD_LF:
+			if (c != '\n')
+				return HTTP_PARSE_ERROR;
+			req->tok = (uint16_t)(pos + 1);
+			req->state = ST_METHOD;
+			break;
+
+		case ST_TARGET:
+			if (c == ' ' && pos > req->tok) {
+				req->target = (http_slice_t){req->tok, (uint16_t)(pos - req->tok)};
+				req->tok = (uint16_t)(pos + 1);
+				req->state = ST_VERSION;
+			} else if (c <= ' ' || c == 0x7F) {
+				return HTTP_PARSE_ERROR;
+			}
+			break;
+
+		case ST_VERSION:
+			if (c == '\r') {
+				const uint8_t* v = buf + req->tok;
+				if (pos - req->tok != 8 || mem_cmp(v, "HTTP/1.", 7) != 0 || v[7] < '0' ||
+					v[7] > '9')
+					return HTTP_PARSE_ERROR;
+				req->version_minor = (uint8_t)(v[7] - '0');
+				req->state = ST_LINE_LF;
+			} else if (c == '\n') {
+				return HTTP_PARSE_ERROR; // bare LF, lines end in CRLF
+			}
+			break;
+
+		case ST_LINE_LF:
+		case ST_VALUE_LF:
+			if (c != '\n')
+				return HTTP_PARSE_ERROR;
+			req->state = ST_NAME_START;
+			break;
+
+		case ST_NAME_START:
+			if (c == '\r') {
+				req->state = ST_END_LF;
+			} else if (is_tchar(c)) {
+				// no obs-fold: a line starting with whitespace is rejected here
+				req->tok = pos;
+				req->state = ST_NAME;
+			} else {
+				return HTTP_PARSE_ERROR;
+			}
+			break;
+
+		case ST_NAME:
+			if (c == ':') {
+				req->hdr = hdr_of(buf + req->tok, (uint16_t)(pos - req->tok));
+				req->state = ST_VALUE_WS;
+			} else if (!is_tchar(c)) {
+				return HTTP_PARSE_ERROR;
+			}
+			break;
+
+		case ST_VALUE_WS:
+			if (is_ws(c))
+				break;
+			req->tok = pos;
+			req->trail = pos;
+			req->state = ST_VALUE;
+			// fall through
+
+		case ST_VALUE:
+			if (c == '\r') {
+				if (store_hdr(req, buf) != 0)
+					return HTTP_PARSE_ERROR;
+				req->state = ST_VALUE_LF;
+			} else if (c == '\n' || c == 0 || c == 0x7F) {
+				return HTTP_PARSE_ERROR;
+			} else if (!is_ws(c)) {
+				req->trail = (uint16_t)(pos + 1);
+			}
+			break;
+
+		case ST_END_LF:
+			if (c != '\n')
+				return HTTP_PARSE_ERROR;
+			return head_done(req);
+
+		default:
+			return HTTP_PARSE_ERROR;
+		}
+	}
+
+	return HTTP_PARSE_MORE;
+}
+
+http_slice_t http_path(const http_req_t* req, const uint8_t* buf) {
+	http_slice_t path = {req->target.off, 0};
+	while (path.len < req->target.len && buf[path.off + path.len] != '?')
+		path.len++;
+	return path;
+}
+
+uint32_t http_body_consume(http_req_t* req, uint32_t avail) {
+	uint32_t n = (avail < req->body_left) ? avail : req->body_left;
+	req->body_left -= n;
+	return n;
+}
+
+// A qvalue of 0 (RFC 9110 12.4.2: "0", "0.", "0.0" .. "0.000") up to the end of its parameter
+static int qvalue_zero(const uint8_t* p, const uint8_t* end) {
+	if (p == end || *p++ != '0')
+		return 0;
+	if (p < end && *p == '.') {
+		p++;
+		while (p < end && *p == '0')
+			p++;
+	}
+	return p == end || *p == ',' || *p == ';' || is_ws(*p);
+}
+
+int http_hdr_has_token(const http_req_t* req,
+	const uint8_t* buf,
+	http_hdr_t hdr,
+	const char* tok,
+	uint8_t tok_len) {
+	if (!http_has(req, hdr))
+		return 0;
+
+	const uint8_t* p = buf + req->hdrs[hdr].off;
+	const uint8_t* end = p + req->hdrs[hdr].len;
+
+	while (p < end) {
+		while (p < end && (is_ws(*p) || *p == ','))
+			p++;
+
+		const uint8_t* elem = p;
+		while (p < end && *p != ',' && *p != ';' && !is_ws(*p))
+			p++;
+
+		int match = 0;
+		if (p - elem == tok_len) {
+			uint8_t i = 0;
+			while (i < tok_len && lower(elem[i]) == lower((uint8_t)tok[i]))
+				i++;
+			match = (i == tok_len);
+		}
+
+		// parameters up to the next element: only a weight of 0 counts, it refuses the token
+		int refused = 0;
+		while (p < end && *p != ',') {
+			if (*p++ != ';')
+				continue;
+			while (p < end && is_ws(*p))
+				p++;
+			if (end - p >= 2 && lower(p[0]) == 'q' && p[1] == '=')
+				refused = qvalue_zero(p + 2, end);
+		}
+
+		if (match && !refused)
+			return 1;
+	}
+
+	return 0;
+}
+
+int http_etag_match(const http_req_t* req, const uint8_t* buf, const char* etag, uint8_t etag_len) {
+	if (!http_has(req, HTTP_HDR_IF_NONE_MATCH))
+		return 0;
+
+	const uint8_t* p = buf + req->hdrs[HTTP_HDR_IF_NONE_MATCH].off;
+	const uint8_t* end = p + req->hdrs[HTTP_HDR_IF_NONE_MATCH].len;
+
+	if (end - p == 1 && *p == '*')
+		return 1;
+
+	while (p < end) {
+		while (p < end && (is_ws(*p) || *p == ','))
+			p++;
+
+		// W/ only makes a tag weak, the weak comparison ignores it
+		if (end - p >= 2 && p[0] == 'W' && p[1] == '/')
+			p += 2;
+
+		if (p == end || *p != '"')
+			return 0; // malformed list, the request is served unconditionally
+
+		// opaque-tag: commas are allowed inside the quotes, so scan to the closing one
+		const uint8_t* tag = p++;
+		while (p < end && *p != '"')
+			p++;
+		if (p == end)
+			return 0;
+		p++;
+
+		if (p - tag == etag_len && mem_cmp(tag, etag, etag_len) == 0)
+			return 1;
+	}
+
+	return 0;
+}
+
+int http_keep_alive(const http_req_t* req, const uint8_t* buf) {
+	if (http_hdr_has_token(req, buf, HTTP_HDR_CONNECTION, "close", 5))
+		return 0;
+	if (req->version_minor >= 1)
+		return 1;
+	return http_hdr_has_token(req, buf, HTTP_HDR_CONNECTION, "keep-alive", 10);
+}
@@ -0,0 +1,92 @@
+#include "modules/log_udp.h"
+#include "FreeRTOS.h" // IWYU pragma: keep
+#include "memutils.h"
+#include "modules/logger.h"
+#include "modules/net.h"
+#include "ports/w5500_port.h"
+#include "socket.h"
+
+#define DGRAM_HDR 2 // sequence number
+
+static uint8_t dgram[DGRAM_HDR + NET_LOG_BATCH];
+static uint16_t batch_len; // bytes after the header
+static uint16_t seq;	   // of the next datagram, a dropped batch skips one
+static uint8_t in_flight;  // SEND issued, SENDOK not seen yet
+static volatile uint8_t sock_open;
+
+void log_udp_open(void) {
+	static uint8_t dest_ip[4] = NET_LOG_DEST_IP;
+
+	// UDP sends a datagram whole or not at all
+	configASSERT(getSn_TXBUF_SIZE(NET_LOG_SOCK) * 1024u >= DGRAM_HDR + NET_LOG_BATCH);
+
+	if (socket(NET_LOG_SOCK, Sn_MR_UDP, NET_LOG_SRC_PORT, SF_IO_NONBLOCK) != NET_LOG_SOCK) {
+		LOG_TEXT(LOG_LEVEL_ERROR, LOG_MOD_NET, "LOG UDP:", "socket() FAIL");
+		return;
+	}
+
+	// a plain SEND goes to Sn_DIPR:Sn_DPORT, set once here instead of per sendto()
+	setSn_DIPR(NET_LOG_SOCK, dest_ip);
+	setSn_DPORT(NET_LOG_SOCK, NET_LOG_DEST_PORT);
+	// polled by send_done(), never routed to INTn (not in the SIMR of w5500_irq_attach())
+	setSn_IMR(NET_LOG_SOCK, Sn_IR_SENDOK | Sn_IR_TIMEOUT);
+	sock_open = 1;
+}
+
+// Previous datagram done: SENDOK, or TIMEOUT when ARP for the collector failed (it is lost)
+static uint8_t send_done(void) {
+	if (!in_flight)
+		return 1;
+
+	uint8_t ir = getSn_IR(NET_LOG_SOCK) & (Sn_IR_SENDOK | Sn_IR_TIMEOUT);
+	if (ir == 0)
+		return 0;
+
+	setSn_IR(NET_LOG_SOCK, ir);
+	in_flight = 0;
+	return 1;
+}
+
+// 0 if the batch went out (or was empty), -1 if it is still here
+static int batch_send(void) {
+	if (batch_len == 0)
+		return 0;
+	if (!sock_open || !send_done())
+		return -1;
+
+	dgram[0] = (uint8_t)seq;
+	dgram[1] = (uint8_t)(seq >> 8);
+
+	const w5500_tx_seg_t seg = {dgram, (uint16_t)(DGRAM_HDR + batch_len)};
+	if (w5500_sock_sendv(NET_LOG_SOCK, &seg, 1, 0) != 0)
+		return -1;
+
+	in_flight = 1;
+	seq++;
+	batch_len = 0;
+	return 0;
+}
+
+void log_udp_record(uint16_t max_len) {
+	if (batch_len + max_len <= NET_LOG_BATCH)
+		return;
+
+	if (batch_send() != 0) {
+		// the previous datagram is still out: lose this batch rather than wait for the wire
+		seq++;
+		batch_len = 0;
+	}
+}
+
+void log_udp_append(const uint8_t* data, uint16_t len) {
+	if (len > NET_LOG_BATCH - batch_len)
+		len = (uint16_t)(NET_LOG_BATCH - batch_len); // only past a log_udp_record() too small
+
+	mem_cpy(dgram + DGRAM_HDR + batch_len, data, len);
+	batch_len = (uint16_t)(batch_len + len);
+}
+
+uint8_t log_udp_flush(void) {
+	// before the socket is open there is nothing to retry for, log_udp_open() does not wake us
+	return (uint8_t)(sock_open && batch_send() != 0);
+}
@@ -1,25 +1,90 @@
 #include "modules/logger.h"
 #include "FreeRTOS.h" // IWYU pragma: keep
+#include "board.h" // LDREX/STREX, DMB
 #include "drivers/uarte.h"
 #include "memutils.h"
+#include "modules/log_udp.h"
 #include "task.h"
 
-static log_t log_q[LOGGER_QUEUE_CAP];
-static volatile uint8_t front;	 // read idx
-static volatile uint8_t rear;	 // write idx
-static volatile uint8_t ctr;	 // number of valid entries (0..CAP)
-static volatile uint8_t dropped; // will use later
+// Queued records, variable length: a 4 byte header, then the body.
+// ASCII records: header {type, body len, label len, 0}, body = label + payload.
+// Token records: header {LOG_TOKEN, 4 * nargs, id lo, id hi}, body = the argument words.
+//
+// Lock-free, multi-producer (tasks and ISRs), single consumer (logger_task). A record takes
+// whole slots. Producers reserve slots with LDREX/STREX on ring_head and never wait: the
+// ring overwrites the oldest records by wrapping over them. Each slot carries the sequence
+// number it was written for (its position, plus a record-start bit), stamped after its data.
+// The consumer follows with its own position and checks the stamps before and after copying.
+// A stamp that does not match means the slot is not written yet, or was overwritten (lapped).
+//
+// Slots are claimed (BUSY) and stamped with LDREX/STREX on their seq, and a producer only
+// writes data into slots it holds BUSY. It claims a slot holding an older position that nobody
+// holds. A BUSY slot of an older position belongs to a producer that was lapped while writing:
+// that one may still store into it, so the newer producer leaves it alone. It marks the slot
+// DEAD (the holder turns it into a plain DEAD when it stamps) and gives its whole record up,
+// marking the rest of its slots DEAD as well so the consumer skips them instead of waiting.
+// A producer lapped before it holds all its slots gives them back DEAD. The cost: a slot
+// released DEAD and not yet reclaimed when the consumer arrives at it drops the record that
+// is about to be written there.
+#define LOGGER_RETRY_TICKS pdMS_TO_TICKS(2)
+
+// Repeat suppression: last_rec holds a hash of the last record queued (upper 24 bits) and how
+// many identical ones were dropped after it (low 8 bits). The count is written out as one
+// summary record before the next different record, or when the logger runs out of work.
+#define REPEAT_MASK 0xFFu
+
+#define REC_HDR 4u
+#define REC_MAX (REC_HDR + LOGGER_MAX_LOG_LABEL + LOGGER_MAX_LOG_PAYLOAD)
+#define OUT_MAX (LOGGER_MAX_LOG_LABEL + 2 * LOGGER_MAX_LOG_PAYLOAD + 2) // longest rendered record
+
+#define SLOT_DATA 12u
+#define SLOT_COUNT (LOGGER_RING_SIZE / sizeof(slot_t))
+#define SLOT_MASK (SLOT_COUNT - 1u)
+#define SEQ(pos, start) (((pos) << 3) | (start)) // written, start = first slot of a record
+#define SEQ_BUSY(pos) (((pos) << 3) | 2u)	 // claimed, being written
+#define SEQ_DEAD(pos) (((pos) << 3) | 4u)	 // given up, | SEQ_BUSY: still held by its writer
+#define SEQ_OLDER(a, b) ((int32_t)(((a) & ~7u) - ((b) & ~7u)) < 0) // position of a before b
+
+typedef struct {
+	volatile uint32_t seq;
+	uint8_t data[SLOT_DATA];
+} slot_t;
+
+_Static_assert((SLOT_COUNT & SLOT_MASK) == 0, "LOGGER_RING_SIZE must be a power of two");
+
+static slot_t ring[LOGGER_RING_SIZE / sizeof(slot_t)];
+static volatile uint32_t ring_head; // next slot to reserve, free running
+static volatile uint32_t ring_tail; // consumer position, published for the wakeup check
+static volatile uint32_t dropped;   // slots lost to overwrites, will use later
+static volatile uint32_t last_rec;  // see REPEAT_MASK
+
+volatile uint8_t logger_levels[LOG_MOD_COUNT] = {
+	[LOG_MOD_APP] = LOG_LEVEL_MAX,
+	[LOG_MOD_SPI] = LOG_LEVEL_MAX,
+	[LOG_MOD_W5500] = LOG_LEVEL_MAX,
+	[LOG_MOD_NET] = LOG_LEVEL_MAX,
+	[LOG_MOD_HTTP] = LOG_LEVEL_MAX,
+};
 
 static TaskHandle_t logger_task_handle = NULL;
 
-static inline uint8_t idx_next(uint8_t i) {
-	++i;
-	return (i >= LOGGER_QUEUE_CAP) ? 0 : i; // wrap around
+static inline uint32_t rec_slots(uint32_t rec_len) {
+	return (rec_len + SLOT_DATA - 1u) / SLOT_DATA;
+}
+
+// Copies len bytes at byte offset off of the record starting at slot pos
+static void slots_write(uint32_t pos, uint32_t off, const uint8_t* src, uint32_t len) {
+	for (uint32_t i = 0; i < len; i++, off++)
+		ring[(pos + off / SLOT_DATA) & SLOT_MASK].data[off % SLOT_DATA] = src[i];
 }
 
 void logger_init(void) {
+#if LOGGER_UART
 	uarte_init();
-	front = rear = ctr = dropped = 0;
+#endif
+	ring_head = ring_tail = dropped = last_rec = 0;
+	for (uint32_t i = 0; i < SLOT_COUNT; i++)
+		ring[i].seq = SEQ(i - SLOT_COUNT, 0); // a lap behind: not written yet
 
 	BaseType_t ok = xTaskCreate(logger_task, /* Task function */
 		"logger_task",			 /* Name (for debug) */
@@ -36,52 +101,253 @@ void logger_init(void) {
 	}
 }
 
-// Enqueue log entry: overwrite oldest when full
-void logger_log(log_t log) {
-	if (log.len > LOGGER_MAX_LOG_PAYLOAD) {
-		log.len = LOGGER_MAX_LOG_PAYLOAD;
+void logger_set_level(log_module_t mod, uint8_t level) {
+	if (mod < LOG_MOD_COUNT)
+		logger_levels[mod] = level;
+}
+
+// FNV-1a, folded to the bits above REPEAT_MASK
+static uint32_t rec_hash(uint32_t h, const uint8_t* p, uint8_t n) {
+	for (uint8_t i = 0; i < n; i++)
+		h = (h ^ p[i]) * 16777619u;
+	return h;
+}
+
+// Takes the slot for position p: as want (BUSY, or DEAD to only mark it given up) if nobody
+// holds it, 1. Held by a lapped producer: marked, 0. Lapped ourselves: -1.
+static int slot_claim(uint32_t p, uint32_t want) {
+	volatile uint32_t* seq = &ring[p & SLOT_MASK].seq;
+	uint32_t s;
+	uint32_t next;
+
+	do {
+		s = __LDREXW(seq);
+		// lapped while preempted: this slot belongs to a newer record now
+		if (ring_head - p > SLOT_COUNT || !SEQ_OLDER(s, SEQ(p, 0))) {
+			__CLREX();
+			return -1;
+		}
+		next = (s & SEQ_BUSY(0)) ? (s | SEQ_DEAD(0)) : want;
+	} while (__STREXW(next, seq) != 0);
+
+	return (s & SEQ_BUSY(0)) ? 0 : 1;
+}
+
+// Lets go of a slot we hold: stamped as done, or DEAD if a newer producer marked it meanwhile
+static void slot_release(uint32_t p, uint32_t done) {
+	volatile uint32_t* seq = &ring[p & SLOT_MASK].seq;
+	uint32_t s;
+
+	do {
+		s = __LDREXW(seq);
+	} while (__STREXW((s == SEQ_BUSY(p)) ? done : SEQ_DEAD(p), seq) != 0);
+}
+
+// Enqueue one record from up to two body parts: overwrite oldest when full.
+// Callable from tasks and ISRs, no critical section.
+static void logger_put_raw(const uint8_t hdr[REC_HDR],
+	const uint8_t* p1,
+	uint8_t n1,
+	const uint8_t* p2,
+	uint8_t n2) {
+	uint32_t n = rec_slots(REC_HDR + hdr[1]);
+	uint32_t pos;
+
+	do {
+		pos = __LDREXW(&ring_head);
+	} while (__STREXW(pos + n, &ring_head) != 0);
+
+	uint32_t held = 0;
+	int rc = 1;
+	while (held < n && (rc = slot_claim(pos + held, SEQ_BUSY(pos + held))) > 0)
+		held++;
+
+	if (held == n) {
+		__DMB();
+		slots_write(pos, 0, hdr, REC_HDR);
+		slots_write(pos, REC_HDR, p1, n1);
+		slots_write(pos, REC_HDR + n1, p2, n2);
+		__DMB();
+
+		for (uint32_t i = 0; i < n; i++)
+			slot_release(pos + i, SEQ(pos + i, i == 0));
+	} else { // give the record up
+		for (uint32_t i = 0; i < held; i++)
+			slot_release(pos + i, SEQ_DEAD(pos + i));
+		for (uint32_t i = held + 1; rc == 0 && i < n; i++)
+			rc = (slot_claim(pos + i, SEQ_DEAD(pos + i)) < 0) ? -1 : 0;
 	}
-	uint8_t was_empty = 0;
+	__DMB();
 
-	taskENTER_CRITICAL();
-	was_empty = (ctr == 0);
+	// the consumer is (about to be) blocked on exactly this record
+	if (ring_tail != pos || logger_task_handle == NULL)
+		return;
 
-	if (ctr == LOGGER_QUEUE_CAP) {	 // full queue
-		front = idx_next(front); // drop oldest, ctr stays at CAP
-		++dropped;
+	if (xPortIsInsideInterrupt() == pdTRUE) {
+		BaseType_t woken = pdFALSE;
+		vTaskNotifyGiveFromISR(logger_task_handle, &woken);
+		portYIELD_FROM_ISR(woken);
 	} else {
-		++ctr;
+		xTaskNotifyGive(logger_task_handle); // wake logger task if it was waiting for logs
 	}
+}
 
-	log_q[rear] = log; // struct copy
-	rear = idx_next(rear);
+static void logger_put_repeats(uint32_t count) {
+	LOG_FMT_("LOG: last message repeated %u times");
+	uint8_t hdr[REC_HDR] = {LOG_TOKEN, 4, (uint8_t)LOG_ID_, (uint8_t)(LOG_ID_ >> 8)};
+	logger_put_raw(hdr, (const uint8_t*)&count, sizeof(count), NULL, 0);
+}
 
-	taskEXIT_CRITICAL();
+// logger_put_raw, unless the record is the same as the last one: then it is only counted
+static void logger_put(const uint8_t hdr[REC_HDR],
+	const uint8_t* p1,
+	uint8_t n1,
+	const uint8_t* p2,
+	uint8_t n2) {
+	uint32_t key = rec_hash(rec_hash(rec_hash(2166136261u, hdr, REC_HDR), p1, n1), p2, n2);
+	key &= ~REPEAT_MASK;
+
+	uint32_t old;
+	uint32_t next;
+	do {
+		old = __LDREXW(&last_rec);
+		if ((old & ~REPEAT_MASK) == key && (old & REPEAT_MASK) != REPEAT_MASK)
+			next = old + 1;
+		else
+			next = key; // different, or the count is full: flush it and start over
+	} while (__STREXW(next, &last_rec) != 0);
+
+	if (next != key)
+		return;
+
+	if ((old & REPEAT_MASK) != 0)
+		logger_put_repeats(old & REPEAT_MASK);
+	logger_put_raw(hdr, p1, n1, p2, n2);
+}
 
-	if (was_empty && logger_task_handle != NULL) {
-		xTaskNotifyGive(logger_task_handle); // wake logger task if it was waiting for logs
-	}
+// Idle logger: report repeats still being counted, keep the hash so they stay suppressed
+static void logger_flush_repeats(void) {
+	uint32_t old;
+	do {
+		old = __LDREXW(&last_rec);
+		if ((old & REPEAT_MASK) == 0) {
+			__CLREX();
+			return;
+		}
+	} while (__STREXW(old & ~REPEAT_MASK, &last_rec) != 0);
+
+	logger_put_repeats(old & REPEAT_MASK);
 }
 
-uint8_t logger_try_pop(log_t* out) {
-	if (out == NULL) {
-		return 0;
+// Stamps of the n slots of the record at r: 1 all written, 0 not (yet), -1 one is DEAD
+static int rec_stamps(uint32_t r, uint32_t n) {
+	int rc = 1;
+
+	for (uint32_t i = 0; i < n; i++) {
+		uint32_t seq = ring[(r + i) & SLOT_MASK].seq;
+		if (seq == SEQ_DEAD(r + i))
+			return -1;
+		if (seq != SEQ(r + i, i == 0))
+			rc = 0;
 	}
 
-	uint8_t ok = 0;
+	return rc;
+}
+
+// Copies the oldest complete record out: rec must hold REC_MAX bytes. Only logger_task.
+static uint8_t logger_try_pop(uint8_t* rec) {
+	uint32_t r = ring_tail;
+
+	for (;;) {
+		uint32_t head = ring_head;
+		if (r == head)
+			break;
+
+		if (head - r > SLOT_COUNT) { // lapped: skip to the oldest slot still in the ring
+			dropped += head - SLOT_COUNT - r;
+			r = head - SLOT_COUNT;
+		}
+
+		const slot_t* first = &ring[r & SLOT_MASK];
+		uint32_t seq = first->seq;
+		__DMB();
+
+		// middle of a record we lost the start of, or given up: by its producer, or (older
+		// position) by one that found it held by a lapped producer
+		if (seq == SEQ(r, 0) || seq == SEQ_DEAD(r) ||
+			(SEQ_OLDER(seq, SEQ(r, 0)) && (seq & SEQ_DEAD(0)))) {
+			r++;
+			dropped++;
+			continue;
+		}
+		if (seq != SEQ(r, 1)) {
+			if (ring_head - r > SLOT_COUNT)
+				continue; // overwritten under us
+			break;	  // not written yet, its producer wakes us
+		}
+
+		uint8_t len = first->data[1];
+		if (len > REC_MAX - REC_HDR)
+			len = REC_MAX - REC_HDR; // torn header, the stamp check below drops it
+		uint32_t n = rec_slots(REC_HDR + len);
+
+		int ready = rec_stamps(r, n);
+		__DMB();
+
+		if (ready > 0) {
+			for (uint32_t i = 0; i < REC_HDR + len; i++)
+				rec[i] = ring[(r + i / SLOT_DATA) & SLOT_MASK].data[i % SLOT_DATA];
+			__DMB();
 
-	taskENTER_CRITICAL();
+			// still the same stamps after the copy: nobody wrote over it meanwhile
+			ready = rec_stamps(r, n);
+		}
 
-	if (ctr > 0) {
-		*out = log_q[front];
-		front = idx_next(front);
-		--ctr;
-		ok = 1;
+		if (ready < 0) { // drop it: the slots after the first are skipped as middles
+			r++;
+			dropped++;
+			continue;
+		}
+		if (ready == 0) {
+			if (ring_head - r > SLOT_COUNT)
+				continue;
+			break; // a later slot of it is still being written
+		}
+
+		ring_tail = r + n;
+		return 1;
 	}
 
-	taskEXIT_CRITICAL();
+	ring_tail = r;
+	return 0;
+}
+
+static void logger_put_ascii(payload_t type,
+	const char* label,
+	uint8_t label_len,
+	const void* payload,
+	uint8_t payload_len) {
+	if (label == NULL)
+		label_len = 0;
+	if (payload == NULL)
+		payload_len = 0;
+
+	if (label_len > LOGGER_MAX_LOG_LABEL)
+		label_len = LOGGER_MAX_LOG_LABEL;
+
+	if (payload_len > LOGGER_MAX_LOG_PAYLOAD)
+		payload_len = LOGGER_MAX_LOG_PAYLOAD;
 
-	return ok;
+	uint8_t hdr[REC_HDR] = {(uint8_t)type, (uint8_t)(label_len + payload_len), label_len, 0};
+	logger_put(hdr, (const uint8_t*)label, label_len, (const uint8_t*)payload, payload_len);
+}
+
+void logger_token(uint16_t id, uint8_t nargs, const uint32_t* args) {
+	if (nargs > LOGGER_TOKEN_MAX_ARGS)
+		nargs = LOGGER_TOKEN_MAX_ARGS;
+
+	uint8_t hdr[REC_HDR] = {LOG_TOKEN, (uint8_t)(4u * nargs), (uint8_t)id, (uint8_t)(id >> 8)};
+	logger_put(hdr, (const uint8_t*)args, (uint8_t)(4u * nargs), NULL, 0);
 }
 
 // Converts uint32_t to ascii decimals, returns length.
@@ -133,61 +399,101 @@ static uint8_t format_hex_bytes(const uint8_t* in, size_t in_len, uint8_t* out)
 	return (uint8_t)(2u * in_len);
 }
 
-static void fill_label(const uint8_t* label, log_t* log) {
-	for (uint8_t i = 0; i < LOGGER_MAX_LOG_LABEL; i++) {
-		if (label[i] != '\0') {
-			log->label[i] = (uint8_t)label[i];
-		} else {
-			// pad remaining with spaces
-			for (; i < LOGGER_MAX_LOG_LABEL; i++) {
-				log->label[i] = ' ';
-			}
-			break;
-		}
-	}
+// Rendered output, to every sink
+static void log_out(const uint8_t* data, uint16_t len) {
+#if LOGGER_UART
+	uarte_append(data, len);
+#endif
+#if LOGGER_UDP
+	log_udp_append(data, len);
+#endif
+}
+
+// Label padded with spaces to a fixed column, as it always was on the wire
+static void write_label(const uint8_t* label, uint8_t label_len) {
+	uint8_t out[LOGGER_MAX_LOG_LABEL];
+
+	for (uint8_t i = 0; i < LOGGER_MAX_LOG_LABEL; i++)
+		out[i] = (i < label_len && label[i] != '\0') ? label[i] : (uint8_t)' ';
+
+	log_out(out, LOGGER_MAX_LOG_LABEL);
 }
 
 void logger_task(void* arg) {
 	(void)arg;
 
-	log_t log = {0};
+	uint8_t rec[REC_MAX] = {0};
 
 	ulTaskNotifyTake(pdTRUE, 0); // clear
 
 	for (;;) {
 
 		// drain the queue
-		while (logger_try_pop(&log)) {
+		while (logger_try_pop(rec)) {
+#if LOGGER_UDP
+			log_udp_record(OUT_MAX);
+#endif
+			payload_t type = (payload_t)rec[0];
+			uint8_t len = rec[1];
+
+			if (type == LOG_TOKEN) {
+				// raw frame for tools/log_decode.py: mark, nargs, id, args - as queued
+				rec[0] = LOG_FRAME_MARK;
+				rec[1] = (uint8_t)(len / 4u);
+				log_out(rec, REC_HDR + len);
+				continue;
+			}
+
+			uint8_t label_len = rec[2];
+			const uint8_t* payload = rec + REC_HDR + label_len;
+			uint8_t payload_len = (uint8_t)(len - label_len);
 
-			fill_label(log.label, &log);
-			uarte_write(log.label, LOGGER_MAX_LOG_LABEL);
+			write_label(rec + REC_HDR, label_len);
 
-			switch (log.type) {
+			switch (type) {
 			case LOG_UINT: {
 				uint32_t u32 = 0;
-				mem_cpy(&u32, log.payload, sizeof(u32));
+				mem_cpy(&u32, payload, (payload_len < sizeof(u32)) ? payload_len : sizeof(u32));
 
 				uint8_t out[10]; // max uint32_t is 10 digits
 				uint8_t out_len = format_u32(u32, out);
 
-				uarte_write(out, out_len);
+				log_out(out, out_len);
 				break;
 			}
 			case LOG_HEX: {
 				uint8_t out[2 * LOGGER_MAX_LOG_PAYLOAD]; // each byte -> 2 hex chars
-				uint8_t out_len =
-					format_hex_bytes((const uint8_t*)log.payload, log.len, out);
+				uint8_t out_len = format_hex_bytes(payload, payload_len, out);
 
-				uarte_write(out, out_len);
+				log_out(out, out_len);
 				break;
 			}
 			case LOG_STRING:
 			default:
-				uarte_write(log.payload, log.len);
+				log_out(payload, payload_len);
 			}
-			uarte_write((uint8_t*)"\r\n", 2);
+			log_out((const uint8_t*)"\r\n", 2);
 		}
-		ulTaskNotifyTake(pdTRUE, portMAX_DELAY); // block - wait for new logs
+		// records are packed back to back while the previous buffer is on the wire - send the rest
+#if LOGGER_UART
+		uarte_flush();
+#endif
+		uint8_t sink_busy = 0;
+#if LOGGER_UDP
+		sink_busy = log_udp_flush(); // previous datagram still out, SENDOK has no wakeup
+#endif
+
+		// the summary is a record of its own: the next pass picks it up
+		uint32_t head = ring_head;
+		logger_flush_repeats();
+		if (ring_head != head)
+			continue;
+
+		// Stopped on a record still being written: its producer normally wakes us, but may have
+		// looked before we published ring_tail - so do not sleep on it for long.
+		uint8_t retry = (ring_head != ring_tail) || sink_busy;
+		TickType_t wait = retry ? LOGGER_RETRY_TICKS : portMAX_DELAY;
+		ulTaskNotifyTake(pdTRUE, wait); // block - wait for new logs
 	}
 }
 
@@ -195,76 +501,19 @@ void logger_log_literal_len(const char* label,
 	uint8_t label_len,
 	const char* text,
 	uint8_t text_len) {
-	log_t l = {0};
-	l.type = LOG_STRING;
-
-	if (label_len > LOGGER_MAX_LOG_LABEL)
-		label_len = LOGGER_MAX_LOG_LABEL;
-
-	if (text_len > LOGGER_MAX_LOG_PAYLOAD)
-		text_len = LOGGER_MAX_LOG_PAYLOAD;
-
-	if (label && label_len)
-		mem_cpy(l.label, label, label_len);
-
-	if (text && text_len) {
-		mem_cpy(l.payload, text, text_len);
-		l.len = text_len;
-	} else {
-		l.len = 0;
-	}
-
-	logger_log(l);
+	logger_put_ascii(LOG_STRING, label, label_len, text, text_len);
 }
 
 void logger_log_uint_len(const char* label,
 	uint8_t label_len,
 	const void* value,
 	uint8_t value_len) {
-	log_t l = {0};
-	l.type = LOG_UINT;
-
-	if (label_len > LOGGER_MAX_LOG_LABEL)
-		label_len = LOGGER_MAX_LOG_LABEL;
-
-	if (value_len > LOGGER_MAX_LOG_PAYLOAD)
-		value_len = LOGGER_MAX_LOG_PAYLOAD;
-
-	if (label && label_len)
-		mem_cpy(l.label, label, label_len);
-
-	if (value && value_len) {
-		mem_cpy(l.payload, value, value_len);
-		l.len = value_len;
-	} else {
-		l.len = 0;
-	}
-
-	logger_log(l);
+	logger_put_ascii(LOG_UINT, label, label_len, value, value_len);
 }
 
 void logger_log_hex_len(const char* label,
 	uint8_t label_len,
 	const uint8_t* data,
 	uint8_t data_len) {
-	log_t l = {0};
-	l.type = LOG_HEX;
-
-	if (label_len > LOGGER_MAX_LOG_LABEL)
-		label_len = LOGGER_MAX_LOG_LABEL;
-
-	if (data_len > LOGGER_MAX_LOG_PAYLOAD)
-		data_len = LOGGER_MAX_LOG_PAYLOAD;
-
-	if (label && label_len)
-		mem_cpy(l.label, label, label_len);
-
-	if (data && data_len) {
-		mem_cpy(l.payload, data, data_len);
-		l.len = data_len;
-	} else {
-		l.len = 0;
-	}
-
-	logger_log(l);
+	logger_put_ascii(LOG_HEX, label, label_len, data, data_len);
 }
@@ -2,137 +2,513 @@
 #include "FreeRTOS.h"
 #include "drivers/spi.h"
 #include "memutils.h"
+#include "modules/log_udp.h"
+#include "modules/http.h"
+#include "modules/http_routes.h"
 #include "modules/logger.h"
+#include "ports/w5500_port.h"
 #include "socket.h"
 #include "task.h"
 
 static const uint8_t http_socks[HTTP_SOCK_COUNT] = {0, 1, 2, 3};
 
-static uint8_t rx_buf[SPI_MAX_XFER];
-
-// hardcoded for now
-static uint8_t http_resp[] = "HTTP/1.1 200 OK\r\n"
-			     "Content-Type: text/plain\r\n"
-			     "Content-Length: 3\r\n"
-			     "Connection: close\r\n"
-			     "\r\n"
-			     "OK\n";
+// HTTP sockets are 0-3, the rest keep RX only until something uses them
+#if NET_BUF_PROFILE == NET_BUF_PROFILE_HTTP && LOGGER_UDP
+static const w5500_buf_plan_t net_buf_plan = {
+	.tx_kb = {4, 4, 4, 2, 0, 0, 0, 2}, // NET_LOG_SOCK sends the log datagrams
+	.rx_kb = {2, 2, 2, 2, 2, 2, 2, 2},
+};
+#elif NET_BUF_PROFILE == NET_BUF_PROFILE_HTTP
+static const w5500_buf_plan_t net_buf_plan = {
+	.tx_kb = {4, 4, 4, 4, 0, 0, 0, 0},
+	.rx_kb = {2, 2, 2, 2, 2, 2, 2, 2},
+};
+#elif NET_BUF_PROFILE == NET_BUF_PROFILE_EVEN
+static const w5500_buf_plan_t net_buf_plan = {
+	.tx_kb = {2, 2, 2, 2, 2, 2, 2, 2},
+	.rx_kb = {2, 2, 2, 2, 2, 2, 2, 2},
+};
+#else
+#error "unknown NET_BUF_PROFILE"
+#endif
+
+// A generated body piece with its chunk framing, handed to the chip in the same pass
+static uint8_t gen_buf[NET_TX_GEN_SIZE];
+
+#define CHUNK_PREFIX 5 // "XXX\r\n", fixed width - leading zeros are fine in a chunk size
+#define CHUNK_SUFFIX 2
+
+// Heads produced here rather than by a route, Connection and the blank line are added on send
+static const uint8_t http_head_400[] = "HTTP/1.1 400 Bad Request\r\n"
+				       "Content-Length: 0\r\n";
+static const uint8_t http_head_404[] = "HTTP/1.1 404 Not Found\r\n"
+				       "Content-Length: 0\r\n";
+static const uint8_t http_head_431[] = "HTTP/1.1 431 Request Header Fields Too Large\r\n"
+				       "Content-Length: 0\r\n";
+
+static const uint8_t conn_keep_alive[] = "Connection: keep-alive\r\n\r\n";
+static const uint8_t conn_close[] = "Connection: close\r\n\r\n";
+static const uint8_t te_chunked[] = "Transfer-Encoding: chunked\r\n";
+static const uint8_t last_chunk[] = "0\r\n\r\n";
 
 static void log_sock_st(uint8_t sock, uint8_t st) {
-	logger_log_literal_len("NET:",
-		(uint8_t)(sizeof("NET:") - 1),
-		"SOCK STATUS CHANGE",
-		(uint8_t)(sizeof("SOCK STATUS CHANGE") - 1));
+	LOG_TOKEN2(LOG_LEVEL_DEBUG, LOG_MOD_NET, "NET: sock %u status 0x%02x", sock, st);
+}
+
+typedef enum {
+	CONN_ACCEPTING,	      // open in LISTEN, no client
+	CONN_READING_HEADERS, // connected, request head incomplete
+	CONN_READING_BODY,    // head parsed, skipping the request body
+	CONN_SENDING,	      // response picked, waiting for TX room for its next piece
+	CONN_DRAINING,	      // a piece of the response is in the chip, waiting for SENDOK
+	CONN_CLOSING,	      // DISCON issued, waiting for CLOSED
+} conn_state_t;
+
+typedef struct {
+	uint8_t sock;
+	uint8_t sr;	     // last Sn_SR seen, for logging
+	conn_state_t state;
+	TickType_t deadline; // unused in CONN_ACCEPTING
+
+	http_req_t req;
+	uint8_t rx[NET_REQ_BUF_SIZE]; // request head, rx[0] = first byte of the request
+	uint16_t rx_len;
+
+	uint16_t next; // start of the next pipelined request in rx
+
+	http_resp_t resp;   // picked once the head is parsed
+	uint8_t head_sent;  // head and Connection line are in the chip
+	uint32_t body_sent; // body bytes handed to the chip
+	uint8_t chunked;    // body of unknown length, framed as chunks
+	uint8_t body_done;  // generator returned 0 (and the last chunk is in the chip)
+	uint8_t staged;	    // next piece is in TX memory behind the one on the wire, no SEND yet
+	uint8_t keep_alive; // this response keeps the connection open
+	uint16_t served;    // responses sent on this connection
+} conn_t;
+
+static conn_t conns[HTTP_SOCK_COUNT];
+
+static int deadline_passed(TickType_t deadline, TickType_t now) {
+	return (TickType_t)(now - deadline) < (portMAX_DELAY >> 1);
+}
 
-	// log sock id + status as 2 bytes: [sock, st]
-	uint8_t v[2] = {sock, st};
-	logger_log_hex_len("NET:", (uint8_t)(sizeof("NET:") - 1), v, 2);
+static void conn_enter(conn_t* c, conn_state_t state, TickType_t now, TickType_t timeout) {
+	c->state = state;
+	c->deadline = now + timeout;
 }
 
-static void handle_http_sock(uint8_t sock, uint8_t* last_st) {
-	uint8_t st = getSn_SR(sock);
+static void conn_open(conn_t* c) {
+	c->state = CONN_ACCEPTING;
+	c->staged = 0;
+	w5500_tx_drop(c->sock);
 
-	if (st != *last_st) {
-		*last_st = st;
-		log_sock_st(sock, st);
+	int8_t r = socket(c->sock, Sn_MR_TCP, HTTP_PORT, SF_IO_NONBLOCK);
+	if (r != (int8_t)c->sock) {
+		LOG_TEXT(LOG_LEVEL_ERROR, LOG_MOD_NET, "NET:", "socket() FAIL");
+		return;
 	}
+	if (listen(c->sock) != SOCK_OK) {
+		LOG_TEXT(LOG_LEVEL_ERROR, LOG_MOD_NET, "NET:", "listen() FAIL");
+		close(c->sock);
+	}
+}
+
+// Hard close, the socket goes straight back to listening
+static void conn_abort(conn_t* c) {
+	close(c->sock);
+	conn_open(c);
+}
+
+// Graceful close, non-blocking: disconnect() only issues DISCON in SF_IO_NONBLOCK mode
+static void conn_disconnect(conn_t* c, TickType_t now) {
+	disconnect(c->sock);
+	conn_enter(c, CONN_CLOSING, now, CLEANUP_TIMEOUT_TICKS);
+}
+
+static void conn_respond(conn_t* c, const uint8_t* head, uint16_t head_len) {
+	mem_set(&c->resp, 0, sizeof(c->resp));
+	c->chunked = 0;
+	c->resp.head = head;
+	c->resp.head_len = head_len;
+}
+
+#define RESP(h) (h), (uint16_t)(sizeof(h) - 1)
+
+// Picks the response for a parsed head
+static void conn_route(conn_t* c) {
+	// the last request allowed on a connection is answered with Connection: close
+	c->keep_alive = (uint8_t)(http_keep_alive(&c->req, c->rx) &&
+				  c->served + 1u < NET_KEEPALIVE_MAX_REQUESTS);
+
+	http_slice_t path = http_path(&c->req, c->rx);
 
-	switch (st) {
-	case SOCK_CLOSED: {
-		int8_t r = socket(sock, Sn_MR_TCP, HTTP_PORT, 0);
-		if (r != (int8_t)sock) {
-			logger_log_literal_len("NET:",
-				(uint8_t)(sizeof("NET:") - 1),
-				"socket() FAIL",
-				(uint8_t)(sizeof("socket() FAIL") - 1));
-			break;
+	const http_route_t* route = http_route_find(c->rx + path.off, path.len);
+	if (!route) {
+		conn_respond(c, RESP(http_head_404));
+		return;
+	}
+
+	http_handler_t handler = http_route_handler(route, c->req.method);
+	if (!handler) {
+		conn_respond(c, route->not_allowed, route->not_allowed_len);
+		return;
+	}
+
+	mem_set(&c->resp, 0, sizeof(c->resp));
+	if (handler(&c->req, c->rx, &c->resp) != 0) {
+		conn_respond(c, RESP(http_head_404));
+		return;
+	}
+
+	// HTTP/1.0 has no chunks: the end of the body is the end of the connection
+	c->chunked = (uint8_t)(c->resp.body_len == HTTP_BODY_STREAM && c->req.version_minor >= 1);
+	if (c->resp.body_len == HTTP_BODY_STREAM && !c->chunked)
+		c->keep_alive = 0;
+
+	// HEAD: same head, Content-Length or Transfer-Encoding included, no body
+	if (c->req.method == HTTP_METHOD_HEAD) {
+		c->resp.body_len = 0;
+		c->resp.fill = NULL;
+	}
+}
+
+// One DMA read of whatever is waiting (avail from the snapshot, less what is read here),
+// appended to the request buffer, then parsed from where the last call stopped. Bytes left over
+// from a pipelined request are parsed even when nothing new arrived, and while the DMA runs;
+// without such leftovers there is nothing to parse yet and the read is simply waited for.
+// Returns 1 once a response is picked.
+static int conn_read_head(conn_t* c, uint16_t* avail) {
+	uint16_t room = (uint16_t)(sizeof(c->rx) - c->rx_len);
+	uint16_t n = (*avail < room) ? *avail : room;
+	http_parse_rc_t rc;
+
+	if (n > 0 && w5500_rx_start(c->sock, c->rx + c->rx_len, n) == 0) {
+		// parse what is already in rx (pipelined leftovers) while the DMA appends behind it
+		rc = http_parse(&c->req, c->rx, c->rx_len);
+
+		if (w5500_rx_finish(c->sock) == 0) {
+			c->rx_len = (uint16_t)(c->rx_len + n);
+			*avail = (uint16_t)(*avail - n);
 		}
-		if (listen(sock) != SOCK_OK) {
-			logger_log_literal_len("NET:",
-				(uint8_t)(sizeof("NET:") - 1),
-				"listen() FAIL",
-				(uint8_t)(sizeof("listen() FAIL") - 1));
-			close(sock);
+		if (rc == HTTP_PARSE_MORE)
+			rc = http_parse(&c->req, c->rx, c->rx_len);
+	} else {
+		rc = http_parse(&c->req, c->rx, c->rx_len);
+	}
+
+	switch (rc) {
+	case HTTP_PARSE_DONE: {
+		conn_route(c);
+		// what follows the head in rx is body first, then the next request
+		uint16_t extra = (uint16_t)(c->rx_len - c->req.head_len);
+		c->next = (uint16_t)(c->req.head_len + http_body_consume(&c->req, extra));
+		return 1;
+	}
+
+	case HTTP_PARSE_ERROR:
+		// the body is never skipped: the connection closes after the error response
+		conn_respond(c, RESP(http_head_400));
+		c->req.body_left = 0;
+		c->keep_alive = 0;
+		return 1;
+
+	default:
+		// full buffer and still no blank line
+		if (c->rx_len == sizeof(c->rx)) {
+			conn_respond(c, RESP(http_head_431));
+			c->req.body_left = 0;
+			c->keep_alive = 0;
+			return 1;
 		}
-	} break;
+		return 0;
+	}
+}
 
-	case SOCK_LISTEN:
-		// waiting for a client
-		break;
+// Drops body bytes, never past the body: a pipelined request may follow it. They are consumed
+// in the chip without being read over SPI. Returns 1 once the whole body is gone.
+static int conn_skip_body(conn_t* c, uint16_t avail) {
+	uint16_t n = (c->req.body_left < avail) ? (uint16_t)c->req.body_left : avail;
 
-	case SOCK_ESTABLISHED: {
+	if (n > 0) {
+		w5500_rx_skip(c->sock, n);
+		(void)http_body_consume(&c->req, n);
+	}
 
-		TickType_t start_tick = xTaskGetTickCount();
+	return c->req.body_left == 0;
+}
 
-		uint8_t found_rx = 0;
+// 1 while some of the body still has to go to the chip
+static int conn_body_pending(const conn_t* c) {
+	if (c->resp.body_len == HTTP_BODY_STREAM)
+		return !c->body_done;
+	return c->body_sent < c->resp.body_len;
+}
 
-		for (;;) {
-			if (getSn_SR(sock) != SOCK_ESTABLISHED) // state changed
-				break;				// exit
+// Runs the generator for up to room bytes of TX buffer, framed as a chunk when chunked.
+// Returns the piece length in gen_buf, 0 if room is too small for any of it.
+static uint16_t conn_fill(conn_t* c, uint32_t room) {
+	uint32_t frame = c->chunked ? CHUNK_PREFIX + CHUNK_SUFFIX : 0;
+	uint32_t cap = sizeof(gen_buf) - frame;
+
+	if (room <= frame)
+		return 0;
+	if (room - frame < cap)
+		cap = room - frame;
+	if (c->resp.body_len != HTTP_BODY_STREAM && c->resp.body_len - c->body_sent < cap)
+		cap = c->resp.body_len - c->body_sent;
+
+	uint16_t n = c->resp.fill(&c->resp, gen_buf + (c->chunked ? CHUNK_PREFIX : 0), (uint16_t)cap);
+	configASSERT(n <= cap);
+
+	if (n == 0) {
+		// a known length that comes up short would misframe every later response
+		configASSERT(c->resp.body_len == HTTP_BODY_STREAM);
+		c->body_done = 1;
+		return 0;
+	}
 
-			uint16_t avail = getSn_RX_RSR(sock); // some data received from client
+	if (c->chunked) {
+		static const char hex[] = "0123456789abcdef";
+		gen_buf[0] = (uint8_t)hex[(n >> 8) & 0xF];
+		gen_buf[1] = (uint8_t)hex[(n >> 4) & 0xF];
+		gen_buf[2] = (uint8_t)hex[n & 0xF];
+		gen_buf[3] = '\r';
+		gen_buf[4] = '\n';
+		gen_buf[CHUNK_PREFIX + n] = '\r';
+		gen_buf[CHUNK_PREFIX + n + 1] = '\n';
+	}
 
-			if (avail > 0) {
-				// received something from the client
-				found_rx = 1;
+	c->body_sent += n;
+	return (uint16_t)(n + frame);
+}
 
-				// drain what's available - recv() advances W5500 RX read pointer.
-				int32_t n = recv(sock, rx_buf, sizeof(rx_buf));
-				if (n <= 0) {
-					// recv error - stop trying to read
-					break;
-				}
+// Queues the next piece of the response with one SEND (or staged behind the SEND in flight):
+// the head and Connection line first, then as much body as Sn_TX_FSR (from the snapshot) has
+// room for, at most half the TX buffer so the next piece can be staged while this one goes
+// out. Generated bodies are filled into gen_buf only once that room is known. Returns -1 if
+// nothing fits yet, -2 if a generated piece was lost and the connection has to go.
+static int conn_send_next(conn_t* c, uint16_t tx_fsr, uint8_t stage) {
+	w5500_tx_seg_t segs[4];
+	uint8_t count = 0;
+	uint32_t head = 0;
+
+	if (!c->head_sent) {
+		segs[count++] = (w5500_tx_seg_t){c->resp.head, c->resp.head_len};
+		if (c->chunked)
+			segs[count++] = (w5500_tx_seg_t){RESP(te_chunked)};
+		if (c->keep_alive)
+			segs[count++] = (w5500_tx_seg_t){RESP(conn_keep_alive)};
+		else
+			segs[count++] = (w5500_tx_seg_t){RESP(conn_close)};
+		for (uint8_t i = 0; i < count; i++)
+			head += segs[i].len;
+	}
 
-				continue;
-			}
+	uint32_t room = (tx_fsr > head) ? tx_fsr - head : 0;
+	uint32_t chunk = 0;
+	uint8_t generated = 0;
+
+	if (c->resp.fill && conn_body_pending(c)) {
+		uint16_t n = conn_fill(c, room);
+		if (n > 0) {
+			segs[count++] = (w5500_tx_seg_t){gen_buf, n};
+			generated = 1;
+		} else if (c->body_done) {
+			// conn_fill() only asks with room for a framed byte, the last chunk is shorter
+			if (c->chunked)
+				segs[count++] = (w5500_tx_seg_t){RESP(last_chunk)};
+		} else {
+			// counted as a stall unless the snapshot was just stale, retried on the next pass
+			(void)w5500_tx_room(c->sock, (uint16_t)(head + CHUNK_PREFIX + CHUNK_SUFFIX + 1));
+			return -1;
+		}
+	} else {
+		uint32_t left = c->resp.body_len - c->body_sent;
+		uint32_t piece = (uint32_t)net_buf_plan.tx_kb[c->sock] * 1024u / 2u;
+		chunk = (left < room) ? left : room;
+		if (chunk > piece)
+			chunk = piece;
+
+		if (left > 0 && chunk == 0) {
+			// counted as a stall unless the snapshot was just stale, retried on the next pass
+			(void)w5500_tx_room(c->sock, (uint16_t)(head + 1));
+			return -1;
+		}
 
-			// no data available at this moment
-			TickType_t now_tick = xTaskGetTickCount();
+		if (chunk > 0)
+			segs[count++] = (w5500_tx_seg_t){c->resp.body + c->body_sent, (uint16_t)chunk};
+	}
 
-			// If never saw any RX and timeout expired - disconnect - client is idle
-			if (!found_rx && (now_tick - start_tick) >= REQUEST_TIMEOUT_TICKS) {
-				disconnect(sock);
-				break;
-			}
+	// the end of an unframed body: nothing to SEND, SENDOK will not come
+	if (count == 0)
+		return 1;
 
-			// If we already saw some RX, and now it's empty - request drained
-			if (found_rx) {
-				break;
-			}
+	if (w5500_sock_sendv(c->sock, segs, count, stage) != 0)
+		return generated ? -2 : -1;
+
+	c->head_sent = 1;
+	c->body_sent += chunk;
+	return 0;
+}
+
+// While a SEND is in flight, writes the next piece behind it, sent as soon as SENDOK comes.
+// tx_fsr must be read after the last send on c. -1 if the connection has to go.
+static int conn_stage(conn_t* c, uint16_t tx_fsr) {
+	if (c->staged || !conn_body_pending(c))
+		return 0;
+
+	// nothing fits: tried again once SENDOK frees the piece on the wire
+	int rc = conn_send_next(c, tx_fsr, 1);
+	if (rc == 0)
+		c->staged = 1;
+
+	return (rc == -2) ? -1 : 0;
+}
 
-			// Still waiting for first byte: yield - do not hammer getSn_RX_RSR()
-			vTaskDelay(1);
+// Keep-alive: move the pipelined leftovers to the front and start over on the next request
+static void conn_next_request(conn_t* c, TickType_t now) {
+	c->served++;
+
+	mem_move(c->rx, c->rx + c->next, (size_t)(c->rx_len - c->next));
+	c->rx_len = (uint16_t)(c->rx_len - c->next);
+	c->next = 0;
+
+	http_req_init(&c->req);
+	conn_enter(c, CONN_READING_HEADERS, now, NET_KEEPALIVE_IDLE_TICKS);
+}
+
+// Advances one connection as far as it can go without waiting
+static void conn_step(conn_t* c, const w5500_sock_snap_t* snap, TickType_t now) {
+	if (snap->sr != c->sr) {
+		c->sr = snap->sr;
+		log_sock_st(c->sock, snap->sr);
+	}
+
+	// Everything is acked, SENDOK included: a left-over bit would hold INTn low and no further
+	// edge would come. SENDOK is tracked here (CONN_DRAINING), ioLibrary send() is not used.
+	if (snap->ir)
+		w5500_sock_ack(c->sock, snap->ir);
+
+	switch (snap->sr) {
+	case SOCK_CLOSED:
+		conn_open(c);
+		return;
+
+	case SOCK_LISTEN:
+		c->state = CONN_ACCEPTING;
+		return;
+
+	case SOCK_ESTABLISHED:
+	case SOCK_CLOSE_WAIT:
+		break;
+
+	default:
+		// SYNRECV, FIN_WAIT, TIME_WAIT, LAST_ACK... - the chip is busy, only watch the clock
+		if (c->state != CONN_ACCEPTING && deadline_passed(c->deadline, now))
+			conn_abort(c);
+		return;
+	}
+
+	if (c->state == CONN_ACCEPTING) {
+		http_req_init(&c->req);
+		c->rx_len = 0;
+		c->next = 0;
+		c->served = 0;
+		conn_enter(c, CONN_READING_HEADERS, now, REQUEST_TIMEOUT_TICKS);
+	}
+
+	if (c->state == CONN_DRAINING && (snap->ir & Sn_IR_SENDOK)) {
+		if (c->staged) {
+			// the next piece is already in TX memory, the wire is not left idle for a copy
+			w5500_sock_send(c->sock);
+			c->staged = 0;
+			conn_enter(c, CONN_DRAINING, now, SEND_TIMEOUT_TICKS);
+		} else if (conn_body_pending(c)) {
+			// more body to go, the deadline restarts with every piece
+			conn_enter(c, CONN_SENDING, now, SEND_TIMEOUT_TICKS);
+		} else if (!c->keep_alive) {
+			conn_disconnect(c, now);
+			return;
+		} else {
+			// a pipelined request may already be waiting, read on in this same pass
+			conn_next_request(c, now);
 		}
+	}
 
-		// If disconnected while waiting for data, skip sending response
-		if (getSn_SR(sock) == SOCK_ESTABLISHED) {
-			int32_t rc = send(sock, http_resp, (uint16_t)(sizeof(http_resp) - 1));
+	// The request deadline covers head and body, so a client trickling bytes still times out.
+	// Both reads run in the same pass once the head completes.
+	uint16_t avail = snap->rx_rsr;
 
-			if (rc < 0) {
-				logger_log_literal_len("NET:",
-					(uint8_t)(sizeof("NET:") - 1),
-					"send() FAIL",
-					(uint8_t)(sizeof("send() FAIL") - 1));
-				close(sock); // hard recovery
-				break;
-			}
-			// todo later: handle partial send()
+	if (c->state == CONN_READING_HEADERS) {
+		if (conn_read_head(c, &avail))
+			c->state = CONN_READING_BODY;
+	}
 
-			disconnect(sock);
+	if (c->state == CONN_READING_BODY) {
+		// unconditional: the rest of the body may already sit in the chip with no new RECV
+		if (c->req.body_left == 0 || conn_skip_body(c, avail)) {
+			c->head_sent = 0;
+			c->body_sent = 0;
+			c->body_done = 0;
+			c->staged = 0;
+			conn_enter(c, CONN_SENDING, now, SEND_TIMEOUT_TICKS);
 		}
-	} break;
+	}
 
-	case SOCK_CLOSE_WAIT:
+	if (c->state == CONN_READING_HEADERS || c->state == CONN_READING_BODY) {
+		if (snap->sr == SOCK_CLOSE_WAIT)
+			conn_disconnect(c, now); // client is done, or gave up mid-request
+		else if (deadline_passed(c->deadline, now))
+			conn_disconnect(c, now);
+		return;
+	}
+
+	switch (c->state) {
+	case CONN_SENDING: {
+		// a full TX buffer is counted as a stall, retried until the deadline
+		int rc = conn_send_next(c, snap->tx_fsr, 0);
+		if (rc == 0) {
+			conn_enter(c, CONN_DRAINING, now, SEND_TIMEOUT_TICKS);
+			// the snapshot predates this SEND, so Sn_TX_FSR is read again
+			if (conn_stage(c, w5500_tx_fsr(c->sock)) != 0)
+				conn_abort(c);
+		} else if (rc == 1)
+			conn_disconnect(c, now); // unframed body ended, only a close tells the client
+		else if (rc == -2 || deadline_passed(c->deadline, now))
+			conn_abort(c);
+		break;
+	}
+
+	case CONN_DRAINING:
+		// Closing: nothing more is read as a request - discard so the client is not stalled.
+		// Keep-alive: RX holds the next request, it is read once SENDOK comes.
+		if (!c->keep_alive && avail > 0)
+			w5500_rx_skip(c->sock, avail);
 
-		close(sock);
+		if (conn_stage(c, snap->tx_fsr) != 0 || deadline_passed(c->deadline, now))
+			conn_abort(c);
+		break;
+
+	case CONN_CLOSING:
+		if (deadline_passed(c->deadline, now))
+			conn_abort(c);
 		break;
 
 	default:
-		// optional: recover if stuck later
 		break;
 	}
 }
 
+// Connections that only move on an INTn event (or their deadline), no polling needed
+static int conn_quiet(const conn_t* c) {
+	if (c->state == CONN_ACCEPTING)
+		return c->sr == SOCK_LISTEN;
+
+	return c->sr == SOCK_ESTABLISHED &&
+	       (c->state == CONN_READING_HEADERS || c->state == CONN_READING_BODY ||
+		       c->state == CONN_DRAINING);
+}
+
 static void net_task(void* arg) {
 	(void)arg;
 
@@ -157,19 +533,102 @@ static void net_task(void* arg) {
 	configASSERT(mem_cmp(get_net.gw, net.gw, 4) == 0);
 	configASSERT(mem_cmp(get_net.dns, net.dns, 4) == 0);
 
-	uint8_t last_st[HTTP_SOCK_COUNT] = {0xFF, 0xFF, 0xFF, 0xFF};
+#if LOGGER_UDP
+	log_udp_open();
+#endif
+
+	w5500_sock_snap_t snaps[W5500_SOCK_COUNT] = {0};
+	uint8_t http_mask = 0;
+
+	for (uint8_t i = 0; i < HTTP_SOCK_COUNT; i++) {
+		conns[i].sock = http_socks[i];
+		conns[i].sr = 0xFF;
+		conns[i].state = CONN_ACCEPTING;
+		http_mask |= (uint8_t)(1u << http_socks[i]);
+	}
+
+	w5500_irq_attach(http_mask, xTaskGetCurrentTaskHandle());
+
+	uint8_t sweep = 1; // first pass opens every socket
 
 	for (;;) {
+		TickType_t now = xTaskGetTickCount();
+
+		// Sockets flagged in SIR, connections between events and expired deadlines are read in
+		// one batched snapshot. Every socket is read on the safety sweep.
+		uint8_t mask = 0;
+		uint8_t pending = w5500_sock_pending();
+
+		for (uint8_t i = 0; i < HTTP_SOCK_COUNT; i++) {
+			const conn_t* c = &conns[i];
+			uint8_t bit = (uint8_t)(1u << c->sock);
+
+			if ((pending & bit) || sweep || !conn_quiet(c) ||
+				(c->state != CONN_ACCEPTING && deadline_passed(c->deadline, now)))
+				mask |= bit;
+		}
+		sweep = 0;
+
+		uint8_t acked = 0; // sockets whose Sn_IR this pass cleared
+		int snap_ok = w5500_sock_snapshot(mask, snaps) == 0;
+		if (snap_ok) {
+			for (uint8_t i = 0; i < HTTP_SOCK_COUNT; i++) {
+				uint8_t sock = conns[i].sock;
+
+				if (mask & (1u << sock)) {
+					conn_step(&conns[i], &snaps[sock], now);
+					if (snaps[sock].ir)
+						acked |= (uint8_t)(1u << sock);
+				}
+			}
+		}
+
+		// Sleep until the next INTn edge, the nearest deadline or the sweep, whichever is first.
+		// Transitional states (SYNRECV, FIN_WAIT, ...) raise no event - keep polling those.
+		TickType_t wait = NET_SWEEP_TICKS;
+		uint8_t poll = 0;
+
 		for (uint8_t i = 0; i < HTTP_SOCK_COUNT; i++) {
-			handle_http_sock(http_socks[i], &last_st[i]);
+			const conn_t* c = &conns[i];
+
+			if (!conn_quiet(c)) {
+				poll = 1;
+				break;
+			}
+			if (c->state != CONN_ACCEPTING) {
+				TickType_t left = deadline_passed(c->deadline, now) ? 0 : c->deadline - now;
+				if (left < wait)
+					wait = left;
+			}
+		}
+
+		// INTn is edge-detected: only wait once SIR reads 0, else a merged edge is lost. A bit
+		// that came up during the pass, or again on a socket it acked (SENDOK while the pass
+		// staged the next piece), is a new event and gets a pass right away. If the pass could
+		// not clear one it started with (snapshot failed, or nothing to ack), back off rather
+		// than spin - INTn still ends the wait.
+		uint8_t sir = w5500_sock_pending() & http_mask;
+		if (sir) {
+			if (!snap_ok || (sir & pending & (uint8_t)~acked))
+				(void)ulTaskNotifyTake(pdTRUE, NET_POLL_TICKS);
+			continue;
+		}
+
+		// polled, but INTn still wakes it: one socket between events (a closing connection in
+		// FIN_WAIT) must not hold up the SENDOK of another
+		if (poll) {
+			(void)ulTaskNotifyTake(pdTRUE, NET_POLL_TICKS);
+			continue;
 		}
 
-		vTaskDelay(pdMS_TO_TICKS(5));
+		// a deadline wake reads its socket anyway, only an idle timeout sweeps
+		if (ulTaskNotifyTake(pdTRUE, wait) == 0 && wait == NET_SWEEP_TICKS)
+			sweep = 1; // no interrupt for a while - look at everything anyway
 	}
 }
 
 void net_init(void) {
-	w5500_init();
+	w5500_init(&net_buf_plan);
 
 	BaseType_t ok = xTaskCreate(net_task, /* Task function */
 		"net_task",		      /* Name (for debug) */
@@ -0,0 +1,109 @@
+// Route handlers, wired up by src/modules/routes.tbl
+#include "memutils.h"
+#include "modules/assets.h"
+#include "modules/http_routes.h"
+#include "ports/w5500_port.h"
+
+static const uint8_t health_head[] = "HTTP/1.1 200 OK\r\n"
+				    "Content-Type: application/json\r\n"
+				    "Cache-Control: no-store\r\n"
+				    "Content-Length: 15\r\n";
+static const uint8_t health_body[] = "{\"status\":\"ok\"}";
+
+int route_health(const http_req_t* req, const uint8_t* buf, http_resp_t* resp) {
+	(void)req;
+	(void)buf;
+	HTTP_RESP_SET(resp, health_head, health_body);
+	return 0;
+}
+
+static const uint8_t stats_head[] = "HTTP/1.1 200 OK\r\n"
+				   "Content-Type: application/json\r\n"
+				   "Cache-Control: no-store\r\n";
+
+static uint8_t fmt_u32(uint32_t v, uint8_t* out) {
+	uint8_t tmp[10];
+	uint8_t n = 0;
+	do {
+		tmp[n++] = (uint8_t)('0' + v % 10);
+		v /= 10;
+	} while (v);
+
+	for (uint8_t i = 0; i < n; i++)
+		out[i] = tmp[n - 1 - i];
+	return n;
+}
+
+// {"tx_stalls":[n0,...,n7]}, one token per cursor step so a short cap just resumes later
+static uint16_t stats_fill(http_resp_t* resp, uint8_t* out, uint16_t cap) {
+	static const char stats_open[] = "{\"tx_stalls\":[";
+	uint16_t len = 0;
+
+	for (;;) {
+		uint8_t tok[12];
+		uint8_t n;
+
+		if (resp->cursor == 0) {
+			n = (uint8_t)(sizeof(stats_open) - 1);
+			mem_cpy(tok, stats_open, n);
+		} else if (resp->cursor <= W5500_SOCK_COUNT) {
+			uint8_t sn = (uint8_t)(resp->cursor - 1);
+			n = 0;
+			if (sn > 0)
+				tok[n++] = ',';
+			n = (uint8_t)(n + fmt_u32(w5500_tx_stalls(sn), tok + n));
+		} else if (resp->cursor == W5500_SOCK_COUNT + 1) {
+			tok[0] = ']';
+			tok[1] = '}';
+			n = 2;
+		} else {
+			return len;
+		}
+
+		if (len + n > cap)
+			return len;
+
+		mem_cpy(out + len, tok, n);
+		len = (uint16_t)(len + n);
+		resp->cursor++;
+	}
+}
+
+// Generated on the fly, length unknown up front - goes out chunked
+int route_stats(const http_req_t* req, const uint8_t* buf, http_resp_t* resp) {
+	(void)req;
+	(void)buf;
+	resp->head = stats_head;
+	resp->head_len = (uint16_t)(sizeof(stats_head) - 1);
+	resp->body_len = HTTP_BODY_STREAM;
+	resp->fill = stats_fill;
+	return 0;
+}
+
+// Everything under web/, packed into flash at build time
+int route_static(const http_req_t* req, const uint8_t* buf, http_resp_t* resp) {
+	http_slice_t path = http_path(req, buf);
+
+	const asset_t* asset = assets_find(buf + path.off, path.len);
+	if (!asset)
+		return -1;
+
+	const asset_rep_t* rep = &asset->identity;
+	if (asset->gzip.head && http_hdr_has_token(req, buf, HTTP_HDR_ACCEPT_ENCODING, "gzip", 4))
+		rep = &asset->gzip;
+
+	// the client has this body already: head only, the flash body is never touched
+	if (http_etag_match(req, buf, rep->etag, rep->etag_len)) {
+		resp->head = rep->not_modified;
+		resp->head_len = rep->not_modified_len;
+		resp->body = NULL;
+		resp->body_len = 0;
+		return 0;
+	}
+
+	resp->head = rep->head;
+	resp->head_len = rep->head_len;
+	resp->body = rep->body;
+	resp->body_len = rep->body_len;
+	return 0;
+}
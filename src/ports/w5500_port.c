@@ -2,58 +2,525 @@
 #include "FreeRTOS.h" // IWYU pragma: keep
 #include "board.h"
 #include "drivers/spi.h"
-#include "modules/net.h"
+#include "memutils.h"
+#include "modules/logger.h"
+#include "ports/w5500_port.h"
 #include "semphr.h"
 #include "wizchip_conf.h"
 
 #define W5500_CSN_PIN 30
 #define W5500_RST_PIN 31
+#define W5500_INT_PIN 29 // INTn, active low
+
+#define W5500_INT_GPIOTE_CH 0
+#define W5500_INT_IRQ_PRIORITY 6 // must be >= configMAX_SYSCALL_INTERRUPT_PRIORITY (5)
 
 static SemaphoreHandle_t w5500_mutex;
 static StaticSemaphore_t w5500_mutex_buf;
 
-static const spi_device_t w5500_dev = {.cs_pin = W5500_CSN_PIN,
+static TaskHandle_t w5500_irq_task;
+
+static volatile uint32_t tx_stalls[W5500_SOCK_COUNT];
+
+// Bytes written past Sn_TX_WR with no SEND yet (w5500_tx_stage). Sn_TX_WR only moves right
+// before a SEND, never while one is in flight, so the chip still counts these bytes as free:
+// they come off every Sn_TX_FSR reading.
+static uint16_t tx_unsent[W5500_SOCK_COUNT];
+
+static uint16_t tx_free(uint8_t sn, uint16_t fsr) {
+	return (fsr > tx_unsent[sn]) ? (uint16_t)(fsr - tx_unsent[sn]) : 0;
+}
+
+#define W5500_VERSION 0x04
+
+// Sn_IR (0x0002) up to and including Sn_RX_RSR (0x0026-0x0027)
+#define SNAP_FIRST 0x0002
+#define SNAP_LEN (0x0028 - SNAP_FIRST)
+#define SNAP_OFF(reg) ((reg) - SNAP_FIRST)
+
+// frequency is settled by w5500_link_check() before the chip is used
+static spi_device_t w5500_dev = {.bus = SPI_BUS_3,
+	.cs_pin = W5500_CSN_PIN,
 	.mode = SPI_MODE_0,
-	.frequency = SPI_FREQ_8M,
+	.frequency = SPI_FREQ_32M,
 	.order = SPI_MSB_FIRST,
 	.dummy_byte = 0xFF};
 
+// Fastest first. 32 MHz depends on wiring and board layout, so every step is verified.
+static const struct {
+	spi_frequency_t freq;
+	uint32_t mhz;
+} w5500_clocks[] = {
+	{SPI_FREQ_32M, 32},
+	{SPI_FREQ_16M, 16},
+	{SPI_FREQ_8M, 8},
+	{SPI_FREQ_4M, 4},
+};
+
 void cs_select(void) {
 	spi_begin(&w5500_dev);
 }
 
 void cs_deselect(void) {
-	spi_end();
+	spi_end(&w5500_dev);
 }
 
 uint8_t w5500_spi_readbyte(void) {
 	uint8_t b;
-	(void)spi_rx(&b, 1);
+	(void)spi_rx(&w5500_dev, &b, 1);
 	return b;
 }
 
 void w5500_spi_writebyte(uint8_t wb) {
-	(void)spi_tx(&wb, 1);
+	(void)spi_tx(&w5500_dev, &wb, 1);
 }
 
 void w5500_spi_readburst(uint8_t* pBuf, uint16_t len) {
-	(void)spi_rx(pBuf, len);
+	(void)spi_rx(&w5500_dev, pBuf, len);
 }
 
 void w5500_spi_writeburst(uint8_t* pBuf, uint16_t len) {
-	(void)spi_tx(pBuf, len);
+	(void)spi_tx(&w5500_dev, pBuf, len);
 }
 
+// Recursive: port helpers hold it across several ioLibrary calls
 void w5500_cris_enter(void) {
-	xSemaphoreTake(w5500_mutex, portMAX_DELAY);
+	xSemaphoreTakeRecursive(w5500_mutex, portMAX_DELAY);
 }
 
 void w5500_cris_exit(void) {
-	xSemaphoreGive(w5500_mutex);
+	xSemaphoreGiveRecursive(w5500_mutex);
+}
+
+// Builds the 3 byte W5500 SPI frame header (address, BSB, R/W, VDM) for an ioLibrary address
+static void w5500_frame_hdr(uint32_t addr_sel, uint8_t rw, uint8_t hdr[3]) {
+	addr_sel |= (rw | _W5500_SPI_VDM_OP_);
+
+	hdr[0] = (uint8_t)((addr_sel & 0x00FF0000) >> 16);
+	hdr[1] = (uint8_t)((addr_sel & 0x0000FF00) >> 8);
+	hdr[2] = (uint8_t)((addr_sel & 0x000000FF) >> 0);
+}
+
+// Snapshot frames - static so a timed out batch can never point into a dead stack
+static uint8_t snap_hdr[W5500_SOCK_COUNT][3];
+static uint8_t snap_raw[W5500_SOCK_COUNT][SNAP_LEN];
+static spi_seg_t snap_segs[W5500_SOCK_COUNT][2];
+static spi_xfer_t snap_xfer[W5500_SOCK_COUNT];
+
+// RX reads in flight, one per socket
+static uint8_t rx_hdr[W5500_SOCK_COUNT][3];
+static spi_seg_t rx_segs[W5500_SOCK_COUNT][2];
+static spi_xfer_t rx_xfer[W5500_SOCK_COUNT];
+static uint16_t rx_next_rd[W5500_SOCK_COUNT];
+
+uint8_t w5500_sock_pending(void) {
+	return getSIR();
+}
+
+void w5500_sock_ack(uint8_t sn, uint8_t ir) {
+	setSn_IR(sn, ir);
+}
+
+void GPIOTE_IRQHandler(void) {
+	if (GPIOTE_EVENTS_IN_REG(W5500_INT_GPIOTE_CH) == 0)
+		return;
+
+	GPIOTE_EVENTS_IN_REG(W5500_INT_GPIOTE_CH) = 0;
+	(void)GPIOTE_EVENTS_IN_REG(W5500_INT_GPIOTE_CH); // flush the clear before returning
+
+	BaseType_t woken = pdFALSE;
+	if (w5500_irq_task)
+		vTaskNotifyGiveFromISR(w5500_irq_task, &woken);
+	portYIELD_FROM_ISR(woken);
 }
 
-void w5500_init(void) {
-	w5500_mutex = xSemaphoreCreateMutexStatic(&w5500_mutex_buf);
+void w5500_irq_attach(uint8_t mask, TaskHandle_t task) {
+	configASSERT(task);
+
+	w5500_irq_task = task;
+
+	// Sockets outside mask keep their own Sn_IMR: Sn_IR only latches unmasked events, and a
+	// socket polled elsewhere (the log sink) still needs SENDOK. SIMR keeps them off INTn.
+	for (uint8_t sn = 0; sn < W5500_SOCK_COUNT; sn++) {
+		if (mask & (1u << sn))
+			setSn_IMR(sn, W5500_SOCK_IMR);
+	}
+
+	// INTn pin setup
+	GPIO_CNF(W5500_INT_PIN) = (0 << 0) | // DIR = Input
+				  (0 << 1) | // INPUT = Connect
+				  (3 << 2) | // Pull-up
+				  (0 << 8) | // Standard drive
+				  (0 << 16); // No sense
+
+	GPIOTE_CONFIG_REG(W5500_INT_GPIOTE_CH) = (1 << 0) |		    // MODE = Event
+						  (W5500_INT_PIN << 8) | // PSEL
+						  (0 << 13) |		    // PORT = P0
+						  (2 << 16);		    // POLARITY = HiToLo
+	GPIOTE_EVENTS_IN_REG(W5500_INT_GPIOTE_CH) = 0;
+	GPIOTE_INTENSET_REG = (1u << W5500_INT_GPIOTE_CH); // IN[n]
+
+	NVIC_SetPriority(GPIOTE_IRQn, W5500_INT_IRQ_PRIORITY);
+	NVIC_ClearPendingIRQ(GPIOTE_IRQn);
+	NVIC_EnableIRQ(GPIOTE_IRQn);
+
+	// Unmask last, and drop whatever is already latched so INTn starts high
+	for (uint8_t sn = 0; sn < W5500_SOCK_COUNT; sn++) {
+		if (mask & (1u << sn))
+			setSn_IR(sn, 0xFF);
+	}
+	setSIMR(mask);
+}
+
+int w5500_sock_snapshot(uint8_t mask, w5500_sock_snap_t out[W5500_SOCK_COUNT]) {
+	if (mask == 0)
+		return 0;
+
+	int rc = 0;
+	uint8_t last = 0;
+	for (uint8_t sn = 0; sn < W5500_SOCK_COUNT; sn++) {
+		if (mask & (1u << sn))
+			last = sn;
+	}
+
+	w5500_cris_enter();
+
+	// drop completions of an earlier batch that timed out
+	(void)ulTaskNotifyTakeIndexed(SPI_NOTIFY_INDEX, pdTRUE, 0);
+
+	for (uint8_t sn = 0; sn < W5500_SOCK_COUNT; sn++) {
+		if (!(mask & (1u << sn)))
+			continue;
+
+		spi_xfer_t* x = &snap_xfer[sn];
+		if (x->status == SPI_XFER_PENDING) { // still queued from a wedged batch
+			rc = -1;
+			break;
+		}
+
+		w5500_frame_hdr(Sn_IR(sn), _W5500_SPI_READ_, snap_hdr[sn]);
+
+		snap_segs[sn][0] = (spi_seg_t){.tx = snap_hdr[sn], .rx = NULL, .len = 3};
+		snap_segs[sn][1] = (spi_seg_t){.tx = NULL, .rx = snap_raw[sn], .len = SNAP_LEN};
+
+		x->dev = &w5500_dev;
+		x->segs = snap_segs[sn];
+		x->seg_count = 2;
+		x->done = NULL;
+		x->notify = (sn == last) ? xTaskGetCurrentTaskHandle() : NULL;
+
+		if (spi_submit(x) != 0) {
+			rc = -1;
+			break;
+		}
+	}
+
+	// frames run in submit order: the last one completing means the batch is done
+	if (rc == 0 && ulTaskNotifyTakeIndexed(SPI_NOTIFY_INDEX, pdTRUE, SPI_TIMEOUT_TICKS) == 0)
+		rc = -1;
+
+	if (rc != 0) {
+		// take the batch back before the lock goes, so no late frame or notification is left
+		// to end somebody else's wait early
+		for (uint8_t sn = 0; sn < W5500_SOCK_COUNT; sn++) {
+			if (mask & (1u << sn))
+				(void)spi_cancel(&snap_xfer[sn]);
+		}
+		(void)ulTaskNotifyTakeIndexed(SPI_NOTIFY_INDEX, pdTRUE, 0);
+	}
+
+	for (uint8_t sn = 0; rc == 0 && sn < W5500_SOCK_COUNT; sn++) {
+		if (!(mask & (1u << sn)))
+			continue;
+
+		if (snap_xfer[sn].status != 0) {
+			rc = -1;
+			break;
+		}
+
+		// 16-bit counters only grow behind our back and the high byte is read first,
+		// so a torn read can only under-report - safe for both RX_RSR and TX_FSR
+		const uint8_t* r = snap_raw[sn];
+		out[sn].ir = r[SNAP_OFF(0x0002)];
+		out[sn].sr = r[SNAP_OFF(0x0003)];
+		out[sn].tx_fsr = tx_free(sn, (uint16_t)((r[SNAP_OFF(0x0020)] << 8) | r[SNAP_OFF(0x0021)]));
+		out[sn].rx_rsr = (uint16_t)((r[SNAP_OFF(0x0026)] << 8) | r[SNAP_OFF(0x0027)]);
+	}
+
+	w5500_cris_exit();
+
+	if (rc != 0) {
+		LOG_TEXT(LOG_LEVEL_ERROR, LOG_MOD_W5500, "W5500:", "SNAPSHOT FAIL");
+	}
+
+	return rc;
+}
+
+// VERSIONR plus a write/read-back of bit patterns through socket 0 TX memory
+static uint8_t w5500_link_ok(void) {
+	if (getVERSIONR() != W5500_VERSION)
+		return 0;
+
+	static const uint8_t fixed[8] = {0x00, 0xFF, 0x55, 0xAA, 0x0F, 0xF0, 0x5A, 0xA5};
+	uint8_t pattern[64];
+	uint8_t back[64];
+
+	for (uint8_t i = 0; i < sizeof(pattern); i++) {
+		pattern[i] = (i < sizeof(fixed)) ? fixed[i] : (uint8_t)(i * 0x1D + 0x3B);
+	}
+	mem_set(back, 0, sizeof(back));
+
+	uint32_t addr = (0x0000 << 8) + (WIZCHIP_TXBUF_BLOCK(0) << 3);
+	WIZCHIP_WRITE_BUF(addr, pattern, sizeof(pattern));
+	WIZCHIP_READ_BUF(addr, back, sizeof(back));
+
+	return mem_cmp(pattern, back, sizeof(pattern)) == 0;
+}
+
+// Picks the fastest SPI clock the link holds at
+static void w5500_link_check(void) {
+	for (uint8_t i = 0; i < sizeof(w5500_clocks) / sizeof(w5500_clocks[0]); i++) {
+		w5500_dev.frequency = w5500_clocks[i].freq;
+
+		if (w5500_link_ok()) {
+			LOG_VALUE(LOG_LEVEL_INFO,
+				LOG_MOD_W5500,
+				"W5500 SPI MHZ:",
+				&w5500_clocks[i].mhz);
+			return;
+		}
+
+		LOG_VALUE(LOG_LEVEL_WARN, LOG_MOD_W5500, "W5500 LINK FAIL:", &w5500_clocks[i].mhz);
+	}
+
+	// no clock works - wiring problem
+	configASSERT(0);
+}
+
+int w5500_buf_plan_check(const w5500_buf_plan_t* plan) {
+	if (!plan)
+		return -1;
+
+	uint32_t tx_total = 0;
+	uint32_t rx_total = 0;
+
+	for (uint8_t sn = 0; sn < W5500_SOCK_COUNT; sn++) {
+		uint8_t tx = plan->tx_kb[sn];
+		uint8_t rx = plan->rx_kb[sn];
+
+		// 0 or a power of two up to the whole memory
+		if (tx > W5500_BUF_TOTAL_KB || (tx & (tx - 1)) != 0 || rx > W5500_BUF_TOTAL_KB ||
+			(rx & (rx - 1)) != 0) {
+			LOG_TEXT(LOG_LEVEL_ERROR, LOG_MOD_W5500, "W5500:", "BUF PLAN BAD SIZE");
+			return -1;
+		}
+
+		tx_total += tx;
+		rx_total += rx;
+	}
+
+	if (tx_total > W5500_BUF_TOTAL_KB || rx_total > W5500_BUF_TOTAL_KB) {
+		LOG_TEXT(LOG_LEVEL_ERROR, LOG_MOD_W5500, "W5500:", "BUF PLAN OVER 16 KB");
+		return -1;
+	}
+
+	return 0;
+}
+
+int w5500_tx_room(uint8_t sn, uint16_t len) {
+	configASSERT(sn < W5500_SOCK_COUNT);
+
+	if (tx_free(sn, getSn_TX_FSR(sn)) >= len)
+		return 0;
+
+	tx_stalls[sn]++;
+	return -1;
+}
+
+int w5500_tx_begin(w5500_tx_t* tx, uint8_t sn, uint16_t len) {
+	configASSERT(sn < W5500_SOCK_COUNT);
+
+	w5500_cris_enter();
+
+	uint16_t fsr = tx_free(sn, getSn_TX_FSR(sn));
+	if (fsr < len) {
+		tx_stalls[sn]++;
+		w5500_cris_exit();
+		return -1;
+	}
+
+	tx->sn = sn;
+	tx->wr = (uint16_t)(getSn_TX_WR(sn) + tx_unsent[sn]); // after what is staged
+	tx->room = fsr;
+	return 0;
+}
+
+void w5500_tx_append(w5500_tx_t* tx, const uint8_t* data, uint16_t len) {
+	configASSERT(len <= tx->room);
+	if (len == 0)
+		return;
+
+	// same addressing as wiz_send_data(), minus its Sn_TX_WR read and write per call
+	uint32_t addr = ((uint32_t)tx->wr << 8) + (WIZCHIP_TXBUF_BLOCK(tx->sn) << 3);
+	WIZCHIP_WRITE_BUF(addr, (uint8_t*)data, len);
+
+	tx->wr = (uint16_t)(tx->wr + len);
+	tx->room = (uint16_t)(tx->room - len);
+}
+
+// Sn_TX_WR up to wr, then SEND: the previous SEND (if any) must be done
+static void sock_send(uint8_t sn, uint16_t wr) {
+	setSn_TX_WR(sn, wr);
+	setSn_CR(sn, Sn_CR_SEND);
+	while (getSn_CR(sn))
+		; // command accepted within a few SPI frames
+
+	tx_unsent[sn] = 0;
+}
+
+void w5500_tx_commit(w5500_tx_t* tx) {
+	sock_send(tx->sn, tx->wr);
+	w5500_cris_exit();
+}
+
+void w5500_tx_stage(w5500_tx_t* tx, uint16_t len) {
+	// data only: Sn_TX_WR is left alone while the previous SEND is in flight
+	tx_unsent[tx->sn] = (uint16_t)(tx_unsent[tx->sn] + len);
+	w5500_cris_exit();
+}
+
+void w5500_sock_send(uint8_t sn) {
+	configASSERT(sn < W5500_SOCK_COUNT);
+
+	w5500_cris_enter();
+	sock_send(sn, (uint16_t)(getSn_TX_WR(sn) + tx_unsent[sn]));
+	w5500_cris_exit();
+}
+
+uint16_t w5500_tx_fsr(uint8_t sn) {
+	configASSERT(sn < W5500_SOCK_COUNT);
+
+	w5500_cris_enter();
+	uint16_t fsr = tx_free(sn, getSn_TX_FSR(sn));
+	w5500_cris_exit();
+	return fsr;
+}
+
+void w5500_tx_drop(uint8_t sn) {
+	configASSERT(sn < W5500_SOCK_COUNT);
+	tx_unsent[sn] = 0;
+}
+
+uint16_t w5500_tx_unsent(uint8_t sn) {
+	configASSERT(sn < W5500_SOCK_COUNT);
+	return tx_unsent[sn];
+}
+
+int w5500_sock_sendv(uint8_t sn, const w5500_tx_seg_t* segs, uint8_t count, uint8_t stage) {
+	uint32_t total = 0;
+	for (uint8_t i = 0; i < count; i++)
+		total += segs[i].len;
+
+	if (total > 0xFFFF)
+		return -1;
+
+	w5500_tx_t tx;
+	if (w5500_tx_begin(&tx, sn, (uint16_t)total) != 0)
+		return -1;
+
+	for (uint8_t i = 0; i < count; i++)
+		w5500_tx_append(&tx, segs[i].data, segs[i].len);
+
+	if (stage)
+		w5500_tx_stage(&tx, (uint16_t)total);
+	else
+		w5500_tx_commit(&tx);
+	return 0;
+}
+
+int w5500_rx_start(uint8_t sn, uint8_t* buf, uint16_t len) {
+	configASSERT(sn < W5500_SOCK_COUNT);
+	configASSERT(len > 0);
+
+	spi_xfer_t* x = &rx_xfer[sn];
+	if (x->status == SPI_XFER_PENDING) // still queued from a read that timed out
+		return -1;
+
+	w5500_cris_enter();
+
+	// drop a completion left over from a read or snapshot that timed out
+	(void)ulTaskNotifyTakeIndexed(SPI_NOTIFY_INDEX, pdTRUE, 0);
+
+	uint16_t rd = getSn_RX_RD(sn);
+	w5500_frame_hdr(((uint32_t)rd << 8) + (WIZCHIP_RXBUF_BLOCK(sn) << 3),
+		_W5500_SPI_READ_,
+		rx_hdr[sn]);
+
+	rx_segs[sn][0] = (spi_seg_t){.tx = rx_hdr[sn], .rx = NULL, .len = 3};
+	rx_segs[sn][1] = (spi_seg_t){.tx = NULL, .rx = buf, .len = len};
+
+	x->dev = &w5500_dev;
+	x->segs = rx_segs[sn];
+	x->seg_count = 2;
+	x->done = NULL;
+	x->notify = xTaskGetCurrentTaskHandle();
+
+	if (spi_submit(x) != 0) {
+		w5500_cris_exit();
+		return -1;
+	}
+
+	rx_next_rd[sn] = (uint16_t)(rd + len);
+	return 0;
+}
+
+int w5500_rx_finish(uint8_t sn) {
+	configASSERT(sn < W5500_SOCK_COUNT);
+
+	if (ulTaskNotifyTakeIndexed(SPI_NOTIFY_INDEX, pdTRUE, SPI_TIMEOUT_TICKS) == 0) {
+		// take the read back before the lock goes: a late DMA must not land in the caller's
+		// buffer, nor its notification end the next wait early
+		(void)spi_cancel(&rx_xfer[sn]);
+		(void)ulTaskNotifyTakeIndexed(SPI_NOTIFY_INDEX, pdTRUE, 0);
+	}
+
+	// 0 also if it completed right at the timeout
+	int rc = (rx_xfer[sn].status == 0) ? 0 : -1;
+
+	// nothing is consumed unless it was read: a failed read is retried from the same Sn_RX_RD
+	if (rc == 0) {
+		setSn_RX_RD(sn, rx_next_rd[sn]);
+		setSn_CR(sn, Sn_CR_RECV);
+		while (getSn_CR(sn))
+			;
+	}
+
+	w5500_cris_exit();
+	return rc;
+}
+
+void w5500_rx_skip(uint8_t sn, uint16_t len) {
+	configASSERT(sn < W5500_SOCK_COUNT);
+
+	w5500_cris_enter();
+
+	setSn_RX_RD(sn, (uint16_t)(getSn_RX_RD(sn) + len));
+	setSn_CR(sn, Sn_CR_RECV);
+	while (getSn_CR(sn))
+		;
+
+	w5500_cris_exit();
+}
+
+uint32_t w5500_tx_stalls(uint8_t sn) {
+	configASSERT(sn < W5500_SOCK_COUNT);
+	return tx_stalls[sn];
+}
+
+void w5500_init(const w5500_buf_plan_t* plan) {
+	configASSERT(w5500_buf_plan_check(plan) == 0);
+
+	w5500_mutex = xSemaphoreCreateRecursiveMutexStatic(&w5500_mutex_buf);
 	configASSERT(w5500_mutex);
 
 	spi_device_init(&w5500_dev);
@@ -77,7 +544,19 @@ void w5500_init(void) {
 	// Let W5500 finish power-up before first access
 	vTaskDelay(pdMS_TO_TICKS(150));
 
-	uint8_t txsize[8] = {2, 2, 2, 2, 2, 2, 2, 2};
-	uint8_t rxsize[8] = {2, 2, 2, 2, 2, 2, 2, 2};
-	wizchip_init(txsize, rxsize);
+	w5500_link_check();
+
+	uint8_t txsize[W5500_SOCK_COUNT];
+	uint8_t rxsize[W5500_SOCK_COUNT];
+	mem_cpy(txsize, plan->tx_kb, sizeof(txsize));
+	mem_cpy(rxsize, plan->rx_kb, sizeof(rxsize));
+
+	int rc = wizchip_init(txsize, rxsize);
+	configASSERT(rc == 0);
+
+	// read back what the chip took
+	for (uint8_t sn = 0; sn < W5500_SOCK_COUNT; sn++) {
+		configASSERT(getSn_TXBUF_SIZE(sn) == plan->tx_kb[sn]);
+		configASSERT(getSn_RXBUF_SIZE(sn) == plan->rx_kb[sn]);
+	}
 }
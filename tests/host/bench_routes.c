@@ -0,0 +1,102 @@
+// http_route_find() against tables of ROUTE_COUNT exact routes plus a "/*" prefix route, each
+// generated by tools/gen_routes.py as the firmware's own is (make host builds 4 to 128). Every
+// path is checked to land on its route, then the lookup is timed on the host next to a linear
+// compare chain over the same paths - the lookup should stay flat as the table grows, the
+// chain should not.
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "memutils.h"
+#include "modules/http_routes.h"
+#include "sim.h"
+
+#ifndef ROUTE_COUNT
+#error "ROUTE_COUNT: number of exact routes in the generated table"
+#endif
+
+#define ROUNDS (2000000u / ROUTE_COUNT)
+
+int route_bench(const http_req_t* req, const uint8_t* buf, http_resp_t* resp) {
+	(void)req;
+	(void)buf;
+	(void)resp;
+	return 0;
+}
+
+// the paths make host puts in the table, "/api/v1/item001" .. one per route, all one length
+static char paths[ROUTE_COUNT][24];
+static uint16_t path_lens[ROUTE_COUNT];
+
+// paths that are in no table: served by the prefix route
+static const char* const misses[] = {"/", "/index.html", "/api/v1/item000", "/api/v1/items"};
+
+#define MISS_COUNT (sizeof(misses) / sizeof(misses[0]))
+
+// What a routing chain without the table would do
+static int linear_find(const uint8_t* path, uint16_t len) {
+	for (int i = 0; i < ROUTE_COUNT; i++) {
+		if (path_lens[i] == len && mem_cmp(paths[i], path, len) == 0)
+			return i;
+	}
+	return -1;
+}
+
+static uint64_t host_ns(void) {
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+int main(void) {
+	for (int i = 0; i < ROUTE_COUNT; i++)
+		path_lens[i] = (uint16_t)sprintf(paths[i], "/api/v1/item%03d", i + 1);
+
+	for (int i = 0; i < ROUTE_COUNT; i++) {
+		const http_route_t* r = http_route_find((const uint8_t*)paths[i], path_lens[i]);
+		SIM_CHECK(r != NULL && !r->prefix && r->path_len == path_lens[i] &&
+			  memcmp(r->path, paths[i], path_lens[i]) == 0);
+	}
+	for (size_t i = 0; i < MISS_COUNT; i++) {
+		const http_route_t* r = http_route_find((const uint8_t*)misses[i], strlen(misses[i]));
+		SIM_CHECK(r != NULL && r->prefix && r->path_len == 1);
+	}
+
+	if (sim_failures() != 0) {
+		printf("bench_routes: %d failure(s)\n", sim_failures());
+		return 1;
+	}
+
+	volatile uintptr_t sink = 0;
+	uint64_t t0 = host_ns();
+	for (uint32_t n = 0; n < ROUNDS; n++) {
+		for (int i = 0; i < ROUTE_COUNT; i++)
+			sink += (uintptr_t)http_route_find((const uint8_t*)paths[i], path_lens[i]);
+	}
+	uint64_t hit_ns = host_ns() - t0;
+
+	t0 = host_ns();
+	for (uint32_t n = 0; n < ROUNDS; n++) {
+		for (int i = 0; i < ROUTE_COUNT; i++)
+			sink += (uintptr_t)linear_find((const uint8_t*)paths[i], path_lens[i]);
+	}
+	uint64_t linear_ns = host_ns() - t0;
+
+	uint32_t miss_rounds = ROUNDS * ROUTE_COUNT / MISS_COUNT;
+	t0 = host_ns();
+	for (uint32_t n = 0; n < miss_rounds; n++) {
+		for (size_t i = 0; i < MISS_COUNT; i++)
+			sink += (uintptr_t)http_route_find((const uint8_t*)misses[i], strlen(misses[i]));
+	}
+	uint64_t miss_ns = host_ns() - t0;
+	(void)sink;
+
+	double lookups = (double)ROUNDS * ROUTE_COUNT;
+	printf("  %3d routes  %5.1f ns hit  %5.1f ns prefix  %6.1f ns linear chain (host)\n",
+		ROUTE_COUNT,
+		(double)hit_ns / lookups,
+		(double)miss_ns / ((double)miss_rounds * MISS_COUNT),
+		(double)linear_ns / lookups);
+	return 0;
+}
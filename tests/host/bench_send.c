@@ -0,0 +1,130 @@
+// A 32 KB static body served by the whole stack to one client of the W5500 model, at a few
+// round trip times. Reports how long the body takes from the request to its last byte, the
+// throughput that makes, the SENDs it took and the SPI traffic per body byte. The wire alone
+// (100 Mbit/s) would take 2.6 ms and the SPI copy into TX memory (32 MHz) 8.2 ms; every SEND
+// also waits a round trip for its SENDOK, which staging the next piece is meant to hide.
+// Built against an asset dir holding only big.txt (see Makefile), whose bytes are big_byte().
+#include <stdio.h>
+#include <string.h>
+
+#include "board.h"
+#include "drivers/spi.h"
+#include "modules/logger.h"
+#include "modules/net.h"
+#include "sim.h"
+#include "task.h"
+
+#define BOOT_NS 500000000ull
+#define BODY_LEN 32768u
+#define POLL_NS 10000ull // client granularity
+
+static uint8_t big_byte(uint32_t i) {
+	return (uint8_t)(48 + (i * 7919u) % 75u);
+}
+
+static void startup_task(void* arg) {
+	(void)arg;
+
+	logger_init();
+	net_init();
+
+	vTaskDelete(NULL);
+}
+
+// Where the body starts in what the peer got, 0 while the head is incomplete
+static size_t body_start(const uint8_t* rx, size_t len) {
+	for (size_t i = 0; i + 4 <= len; i++) {
+		if (memcmp(rx + i, "\r\n\r\n", 4) == 0)
+			return i + 4;
+	}
+	return 0;
+}
+
+// whichever socket took the connection
+static uint32_t all_sends(void) {
+	uint32_t n = 0;
+
+	for (uint8_t sn = 0; sn < 8; sn++)
+		n += sim_w5500_sends(sn);
+	return n;
+}
+
+static void bench_rtt(uint64_t rtt_ns) {
+	static const char req[] = "GET /big.txt HTTP/1.1\r\nHost: board\r\nConnection: close\r\n\r\n";
+	size_t len = 0;
+	size_t start = 0;
+	const uint8_t* rx = NULL;
+
+	sim_w5500_set_rtt(rtt_ns);
+	int p = sim_tcp_connect(HTTP_PORT);
+	while (sim_tcp_state(p) == SIM_TCP_CONNECTING)
+		sim_wait_ns(POLL_NS);
+
+	uint32_t sends = all_sends();
+	sim_spim_stats_reset(3);
+	uint64_t t0 = sim_now();
+	sim_tcp_send(p, req, sizeof(req) - 1);
+
+	while (sim_now() - t0 < 1000000000ull) {
+		rx = sim_tcp_received(p, &len);
+		if (start == 0)
+			start = body_start(rx, len);
+		if (start != 0 && len >= start + BODY_LEN)
+			break;
+		sim_wait_ns(POLL_NS);
+	}
+	uint64_t took = sim_now() - t0;
+
+	SIM_CHECK(len > 17 && memcmp(rx, "HTTP/1.1 200 OK\r\n", 17) == 0);
+	SIM_CHECK_EQ(len, start + BODY_LEN);
+	for (uint32_t i = 0; i < BODY_LEN && start + i < len; i++) {
+		if (rx[start + i] != big_byte(i)) {
+			sim_fail(__FILE__, __LINE__, "body differs at %u", i);
+			break;
+		}
+	}
+
+	printf("  RTT %5.0f us  %6.2f ms  %5.1f Mbit/s  %3u SENDs  %5.3f SPI bytes per body byte\n",
+		(double)rtt_ns / 1000,
+		(double)took / 1e6,
+		(double)BODY_LEN * 8 * 1e3 / (double)took,
+		all_sends() - sends,
+		(double)sim_spim_stats(3)->bytes / BODY_LEN);
+
+	// let the server close before the next run
+	for (int t = 0; t < 100 && sim_tcp_state(p) != SIM_TCP_CLOSED; t++)
+		vTaskDelay(1);
+	SIM_CHECK_EQ(sim_tcp_state(p), SIM_TCP_CLOSED);
+}
+
+static void client_task(void* arg) {
+	(void)arg;
+
+	sim_wait_ns(BOOT_NS);
+
+	printf("32 KB body, one client (W5500 model, SPIM3 at 32 MHz):\n");
+	bench_rtt(100000);
+	bench_rtt(200000);
+	bench_rtt(1000000);
+
+	SIM_CHECK_EQ(sim_w5500_errors(), 0);
+	sim_finish();
+}
+
+int main(void) {
+	sim_init();
+	sim_w5500_init();
+
+	static const spi_pins_t spi_pins = {.sck = SCK_PIN, .mosi = MOSI_PIN, .miso = MISO_PIN};
+	spim_init(SPI_BUS_3, &spi_pins);
+
+	xTaskCreate(startup_task, "startup", 1024, NULL, 2, NULL);
+	xTaskCreate(client_task, "client", 1024, NULL, 1, NULL);
+	vTaskStartScheduler();
+
+	if (sim_failures() != 0) {
+		printf("bench_send: %d failure(s)\n", sim_failures());
+		return 1;
+	}
+	return 0;
+}
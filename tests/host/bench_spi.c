@@ -0,0 +1,123 @@
+// Small W5500 register accesses through spi.c, the way the ioLibrary port issues them: a read is
+// the 3 byte header then the data in one CS window, a write is header and data in one go.
+// Frames of 4 to 8 bytes on SPIM3 at 32 MHz against the W5500 model.
+//
+// Reported per access: bus time (simulated, START to END of every transfer), bytes EasyDMA
+// moved in either direction, and host time the bench task ran for (spi.c, its ISR and the
+// RTOS stand-in) - the last one only compares builds of this same bench. Build it against an
+// older spi.c with `make host-bench-rev HOST_SPI_REV=<rev>`.
+#include <stdio.h>
+#include <string.h>
+
+#include "board.h"
+#include "drivers/spi.h"
+#include "sim.h"
+#include "task.h"
+
+#define ACCESSES 20000u
+
+#define W5500_SHAR 0x0009u // 6 bytes, read/write
+#define W5500_VERSIONR 0x0039u
+
+static const spi_device_t w5500 = {.bus = SPI_BUS_3,
+	.cs_pin = SIM_W5500_CS_PIN,
+	.mode = SPI_MODE_0,
+	.frequency = SPI_FREQ_32M,
+	.order = SPI_MSB_FIRST,
+	.dummy_byte = 0xFF};
+
+static void hdr(uint8_t* out, uint16_t addr, uint8_t write) {
+	out[0] = (uint8_t)(addr >> 8);
+	out[1] = (uint8_t)addr;
+	out[2] = write ? 0x04 : 0x00; // common block, VDM
+}
+
+static void reg_read(uint16_t addr, uint8_t* data, uint8_t len) {
+	uint8_t h[3];
+
+	hdr(h, addr, 0);
+	spi_begin(&w5500);
+	spi_tx(&w5500, h, 3);
+	spi_rx(&w5500, data, len);
+	spi_end(&w5500);
+}
+
+static void reg_write(uint16_t addr, const uint8_t* data, uint8_t len) {
+	uint8_t frame[8];
+
+	hdr(frame, addr, 1);
+	memcpy(frame + 3, data, len);
+	spi_begin(&w5500);
+	spi_tx(&w5500, frame, (size_t)(3 + len));
+	spi_end(&w5500);
+}
+
+static void report(const char* op, uint8_t frame, uint64_t bus_ns, uint64_t cpu_ns) {
+	const sim_spim_stats_t* st = sim_spim_stats(3);
+
+	printf("  %-5s %u bytes  %7.1f ns bus  %5.1f DMA bytes  %5.2f transfers  %7.1f ns host\n",
+		op,
+		frame,
+		(double)bus_ns / ACCESSES,
+		(double)(st->tx_dma + st->rx_dma) / ACCESSES,
+		(double)st->starts / ACCESSES,
+		(double)cpu_ns / ACCESSES);
+}
+
+static TaskHandle_t bench_task;
+
+static void run(void* arg) {
+	(void)arg;
+	uint8_t data[5];
+	uint8_t back[5];
+
+	// the chip is there and takes what is written
+	reg_read(W5500_VERSIONR, data, 1);
+	SIM_CHECK_EQ(data[0], 0x04);
+
+	printf("W5500 register access, SPIM3 at 32 MHz, %u accesses each:\n", ACCESSES);
+
+	for (uint8_t len = 1; len <= 5; len++) {
+		for (uint8_t i = 0; i < len; i++)
+			data[i] = (uint8_t)(0x11 * (i + 1));
+
+		sim_spim_stats_reset(3);
+		uint64_t t0 = sim_now();
+		uint64_t h0 = sim_task_cpu_ns(bench_task);
+		for (uint32_t n = 0; n < ACCESSES; n++)
+			reg_write(W5500_SHAR, data, len);
+		uint64_t h1 = sim_task_cpu_ns(bench_task);
+		report("write", (uint8_t)(3 + len), sim_now() - t0, h1 - h0);
+
+		sim_spim_stats_reset(3);
+		t0 = sim_now();
+		h0 = sim_task_cpu_ns(bench_task);
+		for (uint32_t n = 0; n < ACCESSES; n++)
+			reg_read(W5500_SHAR, back, len);
+		h1 = sim_task_cpu_ns(bench_task);
+		report("read", (uint8_t)(3 + len), sim_now() - t0, h1 - h0);
+
+		SIM_CHECK(memcmp(data, back, len) == 0);
+	}
+
+	SIM_CHECK_EQ(sim_w5500_errors(), 0);
+	sim_finish();
+}
+
+int main(void) {
+	sim_init();
+	sim_w5500_init();
+
+	static const spi_pins_t pins = {.sck = SCK_PIN, .mosi = MOSI_PIN, .miso = MISO_PIN};
+	spim_init(SPI_BUS_3, &pins);
+	spi_device_init(&w5500);
+
+	xTaskCreate(run, "bench", 1024, NULL, 2, &bench_task);
+	vTaskStartScheduler();
+
+	if (sim_failures() != 0) {
+		printf("bench_spi: %d failure(s)\n", sim_failures());
+		return 1;
+	}
+	return 0;
+}
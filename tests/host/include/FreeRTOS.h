@@ -0,0 +1,47 @@
+#pragma once
+
+// Host build only: the part of the FreeRTOS API the firmware uses, run by tests/host/sim on a
+// simulated clock (1 tick = 1 ms of simulated time). Tasks are cooperative: they only give up
+// the CPU where the real ones would block, so a run is the same every time.
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t TickType_t;
+typedef uint32_t StackType_t;
+
+typedef struct sim_task* TaskHandle_t;
+typedef void (*TaskFunction_t)(void* arg);
+
+#define pdFALSE ((BaseType_t)0)
+#define pdTRUE ((BaseType_t)1)
+#define pdPASS pdTRUE
+#define pdFAIL pdFALSE
+
+#define portMAX_DELAY ((TickType_t)0xFFFFFFFFu)
+
+#define configTICK_RATE_HZ 1000u
+#define configMAX_PRIORITIES 3
+#define configMINIMAL_STACK_SIZE 128
+#define configMAX_SYSCALL_INTERRUPT_PRIORITY (5 << 5)
+#define configTASK_NOTIFICATION_ARRAY_ENTRIES 2
+
+#define pdMS_TO_TICKS(ms) ((TickType_t)(((uint64_t)(ms) * configTICK_RATE_HZ) / 1000u))
+
+void sim_assert_fail(const char* file, int line, const char* expr) __attribute__((noreturn));
+void sim_halt(const char* file, int line) __attribute__((noreturn));
+
+// fails the test run instead of parking the CPU
+#define configASSERT(x)                                                                            \
+	do {                                                                                       \
+		if ((x) == 0)                                                                      \
+			sim_assert_fail(__FILE__, __LINE__, #x);                                   \
+	} while (0)
+
+// interrupt priorities are not modelled: every handler preempts every task
+#define portYIELD_FROM_ISR(woken) sim_yield_from_isr(woken)
+void sim_yield_from_isr(BaseType_t woken);
+
+BaseType_t xPortIsInsideInterrupt(void);
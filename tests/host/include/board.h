@@ -0,0 +1,64 @@
+#pragma once
+#include "nrf52840.h"
+
+// Host build only: include/board.h with pin_low()/pin_high() also reporting the edge to the
+// simulation, which cannot watch OUTSET/OUTCLR writes. Keep the rest in step with the real one.
+
+#define BOARD_NAME "nRF52840-DK (host simulation)"
+
+/* GPIO */
+#define GPIO_PORT NRF_P0
+#define GPIO_CNF(pin) (GPIO_PORT->PIN_CNF[(pin)])
+#define GPIO_OUTSET_REG (GPIO_PORT->OUTSET)
+#define GPIO_OUTCLR_REG (GPIO_PORT->OUTCLR)
+
+/* SPIM instances */
+#define SPIM0_REGS NRF_SPIM0
+#define SPIM0_IRQn SPIM0_SPIS0_TWIM0_TWIS0_SPI0_TWI0_IRQn
+#define SPIM0_IRQHandler SPIM0_SPIS0_TWIM0_TWIS0_SPI0_TWI0_IRQHandler
+#define SPIM3_REGS NRF_SPIM3
+
+/* UARTE */
+#define UARTE NRF_UARTE0
+#define UARTE_ENABLE_REG (UARTE->ENABLE)
+#define UARTE_CONFIG_REG (UARTE->CONFIG)
+#define UARTE_BAUDRATE_REG (UARTE->BAUDRATE)
+#define UARTE_TXD_PTR_REG (UARTE->TXD.PTR)
+#define UARTE_TXD_MAXCNT_REG (UARTE->TXD.MAXCNT)
+#define UARTE_TASKS_STARTTX_REG (UARTE->TASKS_STARTTX)
+#define UARTE_TASKS_STOPTX_REG (UARTE->TASKS_STOPTX)
+#define UARTE_EVENTS_ENDTX_REG (UARTE->EVENTS_ENDTX)
+#define UARTE_EVENTS_TXSTOPPED_REG (UARTE->EVENTS_TXSTOPPED)
+#define UARTE_INTENSET_REG (UARTE->INTENSET)
+#define UARTE_INTENCLR_REG (UARTE->INTENCLR)
+#define UARTE_IRQn UARTE0_UART0_IRQn
+#define UARTE_IRQHandler UARTE0_UART0_IRQHandler
+
+#define UARTE_PSEL_TXD_REG (UARTE->PSEL.TXD)
+#define UARTE_PSEL_RXD_REG (UARTE->PSEL.RXD)
+
+/* GPIOTE */
+#define GPIOTE NRF_GPIOTE
+#define GPIOTE_CONFIG_REG(ch) (GPIOTE->CONFIG[(ch)])
+#define GPIOTE_EVENTS_IN_REG(ch) (GPIOTE->EVENTS_IN[(ch)])
+#define GPIOTE_INTENSET_REG (GPIOTE->INTENSET)
+#define GPIOTE_INTENCLR_REG (GPIOTE->INTENCLR)
+
+/* GPIO Pins */
+#define SCK_PIN 2
+#define MOSI_PIN 26
+#define MISO_PIN 27
+#define TX_PIN 6
+#define RX_PIN 8
+
+void sim_pin_out(uint32_t pin, uint8_t level);
+
+static inline void pin_low(uint32_t pin) {
+	GPIO_OUTCLR_REG = (1u << pin);
+	sim_pin_out(pin, 0);
+}
+
+static inline void pin_high(uint32_t pin) {
+	GPIO_OUTSET_REG = (1u << pin);
+	sim_pin_out(pin, 1);
+}
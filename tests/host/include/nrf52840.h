@@ -0,0 +1,150 @@
+#pragma once
+
+// Host build only: the nRF52840 MDK names the firmware uses. The peripherals are plain structs
+// that tests/host/sim/sim_nrf.c looks at whenever the simulated CPU gives up control, so a
+// TASKS_ write takes effect at the point the firmware next blocks - at the same simulated time.
+// EasyDMA pointers stay 32 bit as on the chip: the host binary is linked without PIE and every
+// buffer the firmware hands to DMA (statics, task stacks) lies below 4 GB.
+
+#include <stdint.h>
+
+typedef enum {
+	UARTE0_UART0_IRQn = 2,
+	SPIM0_SPIS0_TWIM0_TWIS0_SPI0_TWI0_IRQn = 3,
+	GPIOTE_IRQn = 6,
+	SPIM3_IRQn = 47,
+	SIM_IRQ_COUNT,
+} IRQn_Type;
+
+typedef struct {
+	volatile uint32_t PTR;
+	volatile uint32_t MAXCNT;
+	volatile uint32_t AMOUNT;
+	volatile uint32_t LIST;
+} SPIM_DMA_Type;
+
+typedef struct {
+	volatile uint32_t SCK;
+	volatile uint32_t MOSI;
+	volatile uint32_t MISO;
+	volatile uint32_t CSN;
+} SPIM_PSEL_Type;
+
+typedef struct {
+	volatile uint32_t TASKS_START;
+	volatile uint32_t TASKS_STOP;
+	volatile uint32_t EVENTS_STOPPED;
+	volatile uint32_t EVENTS_ENDRX;
+	volatile uint32_t EVENTS_END;
+	volatile uint32_t EVENTS_ENDTX;
+	volatile uint32_t EVENTS_STARTED;
+	volatile uint32_t SHORTS;
+	volatile uint32_t INTENSET;
+	volatile uint32_t INTENCLR;
+	volatile uint32_t ENABLE;
+	SPIM_PSEL_Type PSEL;
+	volatile uint32_t FREQUENCY;
+	SPIM_DMA_Type RXD;
+	SPIM_DMA_Type TXD;
+	volatile uint32_t CONFIG;
+	volatile uint32_t ORC;
+} NRF_SPIM_Type;
+
+typedef struct {
+	volatile uint32_t RTS;
+	volatile uint32_t TXD;
+	volatile uint32_t CTS;
+	volatile uint32_t RXD;
+} UARTE_PSEL_Type;
+
+typedef struct {
+	volatile uint32_t PTR;
+	volatile uint32_t MAXCNT;
+	volatile uint32_t AMOUNT;
+} UARTE_DMA_Type;
+
+typedef struct {
+	volatile uint32_t TASKS_STARTTX;
+	volatile uint32_t TASKS_STOPTX;
+	volatile uint32_t EVENTS_ENDTX;
+	volatile uint32_t EVENTS_TXSTOPPED;
+	volatile uint32_t INTENSET;
+	volatile uint32_t INTENCLR;
+	volatile uint32_t ENABLE;
+	UARTE_PSEL_Type PSEL;
+	volatile uint32_t BAUDRATE;
+	UARTE_DMA_Type TXD;
+	volatile uint32_t CONFIG;
+} NRF_UARTE_Type;
+
+typedef struct {
+	volatile uint32_t OUT;
+	volatile uint32_t OUTSET;
+	volatile uint32_t OUTCLR;
+	volatile uint32_t IN;
+	volatile uint32_t DIR;
+	volatile uint32_t PIN_CNF[32];
+} NRF_GPIO_Type;
+
+typedef struct {
+	volatile uint32_t EVENTS_IN[8];
+	volatile uint32_t INTENSET;
+	volatile uint32_t INTENCLR;
+	volatile uint32_t CONFIG[8];
+} NRF_GPIOTE_Type;
+
+extern NRF_SPIM_Type sim_spim0;
+extern NRF_SPIM_Type sim_spim3;
+extern NRF_UARTE_Type sim_uarte0;
+extern NRF_GPIO_Type sim_p0;
+extern NRF_GPIOTE_Type sim_gpiote;
+
+#define NRF_SPIM0 (&sim_spim0)
+#define NRF_SPIM3 (&sim_spim3)
+#define NRF_UARTE0 (&sim_uarte0)
+#define NRF_P0 (&sim_p0)
+#define NRF_GPIOTE (&sim_gpiote)
+
+// NVIC: enable and pending bits, priorities are recorded but not modelled
+void NVIC_SetPriority(IRQn_Type irqn, uint32_t prio);
+void NVIC_EnableIRQ(IRQn_Type irqn);
+void NVIC_DisableIRQ(IRQn_Type irqn);
+void NVIC_SetPendingIRQ(IRQn_Type irqn);
+void NVIC_ClearPendingIRQ(IRQn_Type irqn);
+
+// Exclusive access: LDREX remembers the address and the value it read, STREX stores only if
+// the word still holds that value (compare-and-swap). Thread safe, for the logger stress test.
+// sim_preempt_hook, if set, runs on every DMB so a test can force a switch right there.
+extern void (*volatile sim_preempt_hook)(void);
+
+extern __thread volatile uint32_t* sim_excl_addr;
+extern __thread uint32_t sim_excl_val;
+
+static inline uint32_t __LDREXW(volatile uint32_t* addr) {
+	uint32_t v = __atomic_load_n(addr, __ATOMIC_SEQ_CST);
+	sim_excl_addr = addr;
+	sim_excl_val = v;
+	return v;
+}
+
+static inline uint32_t __STREXW(uint32_t value, volatile uint32_t* addr) {
+	if (sim_excl_addr != addr)
+		return 1;
+
+	uint32_t expected = sim_excl_val;
+	sim_excl_addr = 0;
+	return __atomic_compare_exchange_n(
+		       addr, &expected, value, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)
+		       ? 0
+		       : 1;
+}
+
+static inline void __CLREX(void) {
+	sim_excl_addr = 0;
+}
+
+static inline void __DMB(void) {
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	if (sim_preempt_hook)
+		sim_preempt_hook();
+}
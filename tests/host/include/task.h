@@ -0,0 +1,39 @@
+#pragma once
+
+#include "FreeRTOS.h"
+
+BaseType_t xTaskCreate(TaskFunction_t fn,
+	const char* name,
+	uint32_t stack_words,
+	void* arg,
+	UBaseType_t prio,
+	TaskHandle_t* handle);
+void vTaskDelete(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+void vTaskStartScheduler(void);
+
+TickType_t xTaskGetTickCount(void);
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+
+// Notifications, configTASK_NOTIFICATION_ARRAY_ENTRIES per task
+uint32_t ulTaskNotifyTakeIndexed(UBaseType_t index, BaseType_t clear, TickType_t ticks);
+BaseType_t xTaskNotifyGiveIndexed(TaskHandle_t task, UBaseType_t index);
+void vTaskNotifyGiveIndexedFromISR(TaskHandle_t task, UBaseType_t index, BaseType_t* woken);
+
+#define ulTaskNotifyTake(clear, ticks) ulTaskNotifyTakeIndexed(0, (clear), (ticks))
+#define xTaskNotifyGive(task) xTaskNotifyGiveIndexed((task), 0)
+#define vTaskNotifyGiveFromISR(task, woken) vTaskNotifyGiveIndexedFromISR((task), 0, (woken))
+
+// Critical sections hold back simulated interrupts, which run when the outermost one ends
+void sim_critical_enter(void);
+void sim_critical_exit(void);
+UBaseType_t sim_critical_enter_isr(void);
+void sim_critical_exit_isr(UBaseType_t saved);
+
+#define taskENTER_CRITICAL() sim_critical_enter()
+#define taskEXIT_CRITICAL() sim_critical_exit()
+#define taskENTER_CRITICAL_FROM_ISR() sim_critical_enter_isr()
+#define taskEXIT_CRITICAL_FROM_ISR(saved) sim_critical_exit_isr(saved)
+
+// only ever used on the way into a fatal loop
+#define taskDISABLE_INTERRUPTS() sim_halt(__FILE__, __LINE__)
@@ -0,0 +1,25 @@
+#pragma once
+
+// Host build only: the socket() API of the ioLibrary (Ethernet/socket.h) the firmware uses
+
+#include <stdint.h>
+
+#include "wizchip_conf.h"
+
+#define SOCK_OK 1
+#define SOCK_BUSY 0
+#define SOCK_FATAL -1000
+
+#define SOCKERR_SOCKNUM (-1)
+#define SOCKERR_SOCKMODE (-5)
+#define SOCKERR_SOCKINIT (-3)
+#define SOCKERR_SOCKCLOSED (-4)
+#define SOCKERR_SOCKSTATUS (-7)
+#define SOCKERR_IPINVALID (-14)
+
+#define SF_IO_NONBLOCK 0x01
+
+int8_t socket(uint8_t sn, uint8_t protocol, uint16_t port, uint8_t flag);
+int8_t close(uint8_t sn);
+int8_t listen(uint8_t sn);
+int8_t disconnect(uint8_t sn);
@@ -0,0 +1,147 @@
+#pragma once
+
+// Host build only: register map and accessors of the ioLibrary W5500 driver (W5500/w5500.h)
+// that the firmware uses. Addresses are ioLibrary style: (offset << 8) + (block << 3).
+
+#include <stdint.h>
+
+#define _W5500_IO_BASE_ 0x00000000
+
+#define _W5500_SPI_READ_ (0x00 << 2)
+#define _W5500_SPI_WRITE_ (0x01 << 2)
+#define _W5500_SPI_VDM_OP_ 0x00
+
+#define WIZCHIP_CREG_BLOCK 0x00
+#define WIZCHIP_SREG_BLOCK(N) (1 + 4 * (N))
+#define WIZCHIP_TXBUF_BLOCK(N) (2 + 4 * (N))
+#define WIZCHIP_RXBUF_BLOCK(N) (3 + 4 * (N))
+
+#define WIZCHIP_OFFSET_INC(ADDR, N) ((ADDR) + ((N) << 8))
+
+// Common registers
+#define MR (_W5500_IO_BASE_ + (0x0000 << 8) + (WIZCHIP_CREG_BLOCK << 3))
+#define GAR (_W5500_IO_BASE_ + (0x0001 << 8) + (WIZCHIP_CREG_BLOCK << 3))
+#define SUBR (_W5500_IO_BASE_ + (0x0005 << 8) + (WIZCHIP_CREG_BLOCK << 3))
+#define SHAR (_W5500_IO_BASE_ + (0x0009 << 8) + (WIZCHIP_CREG_BLOCK << 3))
+#define SIPR (_W5500_IO_BASE_ + (0x000F << 8) + (WIZCHIP_CREG_BLOCK << 3))
+#define SIR (_W5500_IO_BASE_ + (0x0017 << 8) + (WIZCHIP_CREG_BLOCK << 3))
+#define SIMR (_W5500_IO_BASE_ + (0x0018 << 8) + (WIZCHIP_CREG_BLOCK << 3))
+#define VERSIONR (_W5500_IO_BASE_ + (0x0039 << 8) + (WIZCHIP_CREG_BLOCK << 3))
+
+#define MR_RST 0x80
+
+// Socket registers
+#define Sn_MR(N) (_W5500_IO_BASE_ + (0x0000 << 8) + (WIZCHIP_SREG_BLOCK(N) << 3))
+#define Sn_CR(N) (_W5500_IO_BASE_ + (0x0001 << 8) + (WIZCHIP_SREG_BLOCK(N) << 3))
+#define Sn_IR(N) (_W5500_IO_BASE_ + (0x0002 << 8) + (WIZCHIP_SREG_BLOCK(N) << 3))
+#define Sn_SR(N) (_W5500_IO_BASE_ + (0x0003 << 8) + (WIZCHIP_SREG_BLOCK(N) << 3))
+#define Sn_PORT(N) (_W5500_IO_BASE_ + (0x0004 << 8) + (WIZCHIP_SREG_BLOCK(N) << 3))
+#define Sn_DIPR(N) (_W5500_IO_BASE_ + (0x000C << 8) + (WIZCHIP_SREG_BLOCK(N) << 3))
+#define Sn_DPORT(N) (_W5500_IO_BASE_ + (0x0010 << 8) + (WIZCHIP_SREG_BLOCK(N) << 3))
+#define Sn_RXBUF_SIZE(N) (_W5500_IO_BASE_ + (0x001E << 8) + (WIZCHIP_SREG_BLOCK(N) << 3))
+#define Sn_TXBUF_SIZE(N) (_W5500_IO_BASE_ + (0x001F << 8) + (WIZCHIP_SREG_BLOCK(N) << 3))
+#define Sn_TX_FSR(N) (_W5500_IO_BASE_ + (0x0020 << 8) + (WIZCHIP_SREG_BLOCK(N) << 3))
+#define Sn_TX_RD(N) (_W5500_IO_BASE_ + (0x0022 << 8) + (WIZCHIP_SREG_BLOCK(N) << 3))
+#define Sn_TX_WR(N) (_W5500_IO_BASE_ + (0x0024 << 8) + (WIZCHIP_SREG_BLOCK(N) << 3))
+#define Sn_RX_RSR(N) (_W5500_IO_BASE_ + (0x0026 << 8) + (WIZCHIP_SREG_BLOCK(N) << 3))
+#define Sn_RX_RD(N) (_W5500_IO_BASE_ + (0x0028 << 8) + (WIZCHIP_SREG_BLOCK(N) << 3))
+#define Sn_RX_WR(N) (_W5500_IO_BASE_ + (0x002A << 8) + (WIZCHIP_SREG_BLOCK(N) << 3))
+#define Sn_IMR(N) (_W5500_IO_BASE_ + (0x002C << 8) + (WIZCHIP_SREG_BLOCK(N) << 3))
+
+#define Sn_MR_TCP 0x01
+#define Sn_MR_UDP 0x02
+
+#define Sn_CR_OPEN 0x01
+#define Sn_CR_LISTEN 0x02
+#define Sn_CR_DISCON 0x08
+#define Sn_CR_CLOSE 0x10
+#define Sn_CR_SEND 0x20
+#define Sn_CR_RECV 0x40
+
+#define Sn_IR_CON 0x01
+#define Sn_IR_DISCON 0x02
+#define Sn_IR_RECV 0x04
+#define Sn_IR_TIMEOUT 0x08
+#define Sn_IR_SENDOK 0x10
+
+#define SOCK_CLOSED 0x00
+#define SOCK_INIT 0x13
+#define SOCK_LISTEN 0x14
+#define SOCK_SYNRECV 0x16
+#define SOCK_ESTABLISHED 0x17
+#define SOCK_FIN_WAIT 0x18
+#define SOCK_TIME_WAIT 0x1B
+#define SOCK_CLOSE_WAIT 0x1C
+#define SOCK_LAST_ACK 0x1D
+#define SOCK_UDP 0x22
+
+uint8_t WIZCHIP_READ(uint32_t AddrSel);
+void WIZCHIP_WRITE(uint32_t AddrSel, uint8_t wb);
+void WIZCHIP_READ_BUF(uint32_t AddrSel, uint8_t* pBuf, uint16_t len);
+void WIZCHIP_WRITE_BUF(uint32_t AddrSel, uint8_t* pBuf, uint16_t len);
+
+uint16_t getSn_TX_FSR(uint8_t sn);
+uint16_t getSn_RX_RSR(uint8_t sn);
+
+#define getVERSIONR() WIZCHIP_READ(VERSIONR)
+#define getSIR() WIZCHIP_READ(SIR)
+#define setSIMR(v) WIZCHIP_WRITE(SIMR, (v))
+#define setMR(v) WIZCHIP_WRITE(MR, (v))
+#define getMR() WIZCHIP_READ(MR)
+
+#define setSHAR(p) WIZCHIP_WRITE_BUF(SHAR, (p), 6)
+#define getSHAR(p) WIZCHIP_READ_BUF(SHAR, (p), 6)
+#define setGAR(p) WIZCHIP_WRITE_BUF(GAR, (p), 4)
+#define getGAR(p) WIZCHIP_READ_BUF(GAR, (p), 4)
+#define setSUBR(p) WIZCHIP_WRITE_BUF(SUBR, (p), 4)
+#define getSUBR(p) WIZCHIP_READ_BUF(SUBR, (p), 4)
+#define setSIPR(p) WIZCHIP_WRITE_BUF(SIPR, (p), 4)
+#define getSIPR(p) WIZCHIP_READ_BUF(SIPR, (p), 4)
+
+#define setSn_MR(sn, v) WIZCHIP_WRITE(Sn_MR(sn), (v))
+#define getSn_MR(sn) WIZCHIP_READ(Sn_MR(sn))
+#define setSn_CR(sn, v) WIZCHIP_WRITE(Sn_CR(sn), (v))
+#define getSn_CR(sn) WIZCHIP_READ(Sn_CR(sn))
+#define setSn_IR(sn, v) WIZCHIP_WRITE(Sn_IR(sn), ((v) & 0x1F))
+#define getSn_IR(sn) (WIZCHIP_READ(Sn_IR(sn)) & 0x1F)
+#define getSn_SR(sn) WIZCHIP_READ(Sn_SR(sn))
+#define setSn_IMR(sn, v) WIZCHIP_WRITE(Sn_IMR(sn), ((v) & 0x1F))
+#define getSn_IMR(sn) (WIZCHIP_READ(Sn_IMR(sn)) & 0x1F)
+#define setSn_DIPR(sn, p) WIZCHIP_WRITE_BUF(Sn_DIPR(sn), (p), 4)
+
+#define setSn_PORT(sn, v)                                                                          \
+	do {                                                                                       \
+		WIZCHIP_WRITE(Sn_PORT(sn), (uint8_t)((v) >> 8));                                   \
+		WIZCHIP_WRITE(WIZCHIP_OFFSET_INC(Sn_PORT(sn), 1), (uint8_t)(v));                   \
+	} while (0)
+
+#define setSn_DPORT(sn, v)                                                                         \
+	do {                                                                                       \
+		WIZCHIP_WRITE(Sn_DPORT(sn), (uint8_t)((v) >> 8));                                  \
+		WIZCHIP_WRITE(WIZCHIP_OFFSET_INC(Sn_DPORT(sn), 1), (uint8_t)(v));                  \
+	} while (0)
+
+#define setSn_RXBUF_SIZE(sn, v) WIZCHIP_WRITE(Sn_RXBUF_SIZE(sn), (v))
+#define getSn_RXBUF_SIZE(sn) WIZCHIP_READ(Sn_RXBUF_SIZE(sn))
+#define setSn_TXBUF_SIZE(sn, v) WIZCHIP_WRITE(Sn_TXBUF_SIZE(sn), (v))
+#define getSn_TXBUF_SIZE(sn) WIZCHIP_READ(Sn_TXBUF_SIZE(sn))
+
+#define getSn_TX_WR(sn)                                                                            \
+	((uint16_t)((WIZCHIP_READ(Sn_TX_WR(sn)) << 8) +                                            \
+		    WIZCHIP_READ(WIZCHIP_OFFSET_INC(Sn_TX_WR(sn), 1))))
+
+#define setSn_TX_WR(sn, v)                                                                         \
+	do {                                                                                       \
+		WIZCHIP_WRITE(Sn_TX_WR(sn), (uint8_t)((v) >> 8));                                  \
+		WIZCHIP_WRITE(WIZCHIP_OFFSET_INC(Sn_TX_WR(sn), 1), (uint8_t)(v));                  \
+	} while (0)
+
+#define getSn_RX_RD(sn)                                                                            \
+	((uint16_t)((WIZCHIP_READ(Sn_RX_RD(sn)) << 8) +                                            \
+		    WIZCHIP_READ(WIZCHIP_OFFSET_INC(Sn_RX_RD(sn), 1))))
+
+#define setSn_RX_RD(sn, v)                                                                         \
+	do {                                                                                       \
+		WIZCHIP_WRITE(Sn_RX_RD(sn), (uint8_t)((v) >> 8));                                  \
+		WIZCHIP_WRITE(WIZCHIP_OFFSET_INC(Sn_RX_RD(sn), 1), (uint8_t)(v));                  \
+	} while (0)
@@ -0,0 +1,320 @@
+// Host build only: ioLibrary register access (wizchip_conf.c, W5500/w5500.c) and the socket
+// calls the firmware makes (socket.c), reduced to what src/ uses. Each function puts the same
+// frames on the bus as the library does, so SPI byte counts match the firmware on the board.
+#include <stddef.h>
+
+#include "socket.h"
+
+static void cris_none(void) {
+}
+
+static void cs_none(void) {
+}
+
+static uint8_t spi_rb_none(void) {
+	return 0;
+}
+
+static void spi_wb_none(uint8_t wb) {
+	(void)wb;
+}
+
+static struct {
+	void (*cris_enter)(void);
+	void (*cris_exit)(void);
+	void (*cs_select)(void);
+	void (*cs_deselect)(void);
+	uint8_t (*read_byte)(void);
+	void (*write_byte)(uint8_t wb);
+	void (*read_burst)(uint8_t* pBuf, uint16_t len);
+	void (*write_burst)(uint8_t* pBuf, uint16_t len);
+} wiz = {cris_none, cris_none, cs_none, cs_none, spi_rb_none, spi_wb_none, NULL, NULL};
+
+static uint16_t sock_io_mode;
+static uint16_t sock_any_port = 0xC000;
+
+void reg_wizchip_cris_cbfunc(void (*cris_en)(void), void (*cris_ex)(void)) {
+	wiz.cris_enter = cris_en ? cris_en : cris_none;
+	wiz.cris_exit = cris_ex ? cris_ex : cris_none;
+}
+
+void reg_wizchip_cs_cbfunc(void (*cs_sel)(void), void (*cs_desel)(void)) {
+	wiz.cs_select = cs_sel ? cs_sel : cs_none;
+	wiz.cs_deselect = cs_desel ? cs_desel : cs_none;
+}
+
+void reg_wizchip_spi_cbfunc(uint8_t (*spi_rb)(void), void (*spi_wb)(uint8_t wb)) {
+	wiz.read_byte = spi_rb ? spi_rb : spi_rb_none;
+	wiz.write_byte = spi_wb ? spi_wb : spi_wb_none;
+}
+
+void reg_wizchip_spiburst_cbfunc(void (*spi_rb)(uint8_t* pBuf, uint16_t len),
+	void (*spi_wb)(uint8_t* pBuf, uint16_t len)) {
+	wiz.read_burst = spi_rb;
+	wiz.write_burst = spi_wb;
+}
+
+static void spi_header(uint32_t AddrSel, uint8_t* hdr) {
+	hdr[0] = (uint8_t)((AddrSel & 0x00FF0000) >> 16);
+	hdr[1] = (uint8_t)((AddrSel & 0x0000FF00) >> 8);
+	hdr[2] = (uint8_t)((AddrSel & 0x000000FF) >> 0);
+}
+
+static void spi_write(uint8_t* buf, uint16_t len) {
+	if (wiz.write_burst) {
+		wiz.write_burst(buf, len);
+		return;
+	}
+	for (uint16_t i = 0; i < len; i++)
+		wiz.write_byte(buf[i]);
+}
+
+uint8_t WIZCHIP_READ(uint32_t AddrSel) {
+	uint8_t hdr[3];
+	uint8_t ret;
+
+	wiz.cris_enter();
+	wiz.cs_select();
+
+	spi_header(AddrSel | _W5500_SPI_READ_ | _W5500_SPI_VDM_OP_, hdr);
+	spi_write(hdr, 3);
+	ret = wiz.read_byte();
+
+	wiz.cs_deselect();
+	wiz.cris_exit();
+	return ret;
+}
+
+void WIZCHIP_WRITE(uint32_t AddrSel, uint8_t wb) {
+	uint8_t buf[4];
+
+	wiz.cris_enter();
+	wiz.cs_select();
+
+	spi_header(AddrSel | _W5500_SPI_WRITE_ | _W5500_SPI_VDM_OP_, buf);
+	buf[3] = wb;
+	spi_write(buf, 4);
+
+	wiz.cs_deselect();
+	wiz.cris_exit();
+}
+
+void WIZCHIP_READ_BUF(uint32_t AddrSel, uint8_t* pBuf, uint16_t len) {
+	uint8_t hdr[3];
+
+	wiz.cris_enter();
+	wiz.cs_select();
+
+	spi_header(AddrSel | _W5500_SPI_READ_ | _W5500_SPI_VDM_OP_, hdr);
+	spi_write(hdr, 3);
+	if (wiz.read_burst) {
+		wiz.read_burst(pBuf, len);
+	} else {
+		for (uint16_t i = 0; i < len; i++)
+			pBuf[i] = wiz.read_byte();
+	}
+
+	wiz.cs_deselect();
+	wiz.cris_exit();
+}
+
+void WIZCHIP_WRITE_BUF(uint32_t AddrSel, uint8_t* pBuf, uint16_t len) {
+	uint8_t hdr[3];
+
+	wiz.cris_enter();
+	wiz.cs_select();
+
+	spi_header(AddrSel | _W5500_SPI_WRITE_ | _W5500_SPI_VDM_OP_, hdr);
+	spi_write(hdr, 3);
+	spi_write(pBuf, len);
+
+	wiz.cs_deselect();
+	wiz.cris_exit();
+}
+
+// Both halves read until two readings agree, as the library does
+static uint16_t read16_stable(uint32_t addr) {
+	uint16_t val = 0;
+	uint16_t val1 = 0;
+
+	do {
+		val1 = WIZCHIP_READ(addr);
+		val1 = (uint16_t)((val1 << 8) + WIZCHIP_READ(WIZCHIP_OFFSET_INC(addr, 1)));
+		if (val1 != 0) {
+			val = WIZCHIP_READ(addr);
+			val = (uint16_t)((val << 8) + WIZCHIP_READ(WIZCHIP_OFFSET_INC(addr, 1)));
+		}
+	} while (val != val1);
+
+	return val;
+}
+
+uint16_t getSn_TX_FSR(uint8_t sn) {
+	return read16_stable(Sn_TX_FSR(sn));
+}
+
+uint16_t getSn_RX_RSR(uint8_t sn) {
+	return read16_stable(Sn_RX_RSR(sn));
+}
+
+/* ---------------- wizchip_conf.c ---------------- */
+
+static void wizchip_sw_reset(void) {
+	uint8_t gw[4], sn[4], sip[4];
+	uint8_t mac[6];
+
+	getSHAR(mac);
+	getGAR(gw);
+	getSUBR(sn);
+	getSIPR(sip);
+	setMR(MR_RST);
+	getMR(); // for delay
+	setSHAR(mac);
+	setGAR(gw);
+	setSUBR(sn);
+	setSIPR(sip);
+}
+
+int8_t wizchip_init(uint8_t* txsize, uint8_t* rxsize) {
+	int8_t tmp = 0;
+
+	wizchip_sw_reset();
+	if (txsize) {
+		for (int8_t i = 0; i < _WIZCHIP_SOCK_NUM_; i++) {
+			tmp += txsize[i];
+			if (tmp > 16)
+				return -1;
+		}
+		for (int8_t i = 0; i < _WIZCHIP_SOCK_NUM_; i++)
+			setSn_TXBUF_SIZE(i, txsize[i]);
+	}
+
+	tmp = 0;
+	if (rxsize) {
+		for (int8_t i = 0; i < _WIZCHIP_SOCK_NUM_; i++) {
+			tmp += rxsize[i];
+			if (tmp > 16)
+				return -1;
+		}
+		for (int8_t i = 0; i < _WIZCHIP_SOCK_NUM_; i++)
+			setSn_RXBUF_SIZE(i, rxsize[i]);
+	}
+	return 0;
+}
+
+static dhcp_mode net_dhcp = NETINFO_STATIC;
+static uint8_t net_dns[4];
+
+int8_t ctlnetwork(ctlnetwork_type cntype, void* arg) {
+	wiz_NetInfo* info = arg;
+
+	switch (cntype) {
+	case CN_SET_NETINFO:
+		setSHAR(info->mac);
+		setGAR(info->gw);
+		setSUBR(info->sn);
+		setSIPR(info->ip);
+		for (uint8_t i = 0; i < 4; i++)
+			net_dns[i] = info->dns[i];
+		net_dhcp = info->dhcp;
+		return 0;
+	case CN_GET_NETINFO:
+		getSHAR(info->mac);
+		getGAR(info->gw);
+		getSUBR(info->sn);
+		getSIPR(info->ip);
+		for (uint8_t i = 0; i < 4; i++)
+			info->dns[i] = net_dns[i];
+		info->dhcp = net_dhcp;
+		return 0;
+	default:
+		return -1;
+	}
+}
+
+/* ---------------- socket.c ---------------- */
+
+#define CHECK_SOCKNUM()                                                                            \
+	do {                                                                                       \
+		if (sn >= _WIZCHIP_SOCK_NUM_)                                                      \
+			return SOCKERR_SOCKNUM;                                                    \
+	} while (0)
+
+int8_t socket(uint8_t sn, uint8_t protocol, uint16_t port, uint8_t flag) {
+	CHECK_SOCKNUM();
+
+	if (protocol == Sn_MR_TCP) {
+		uint8_t ip[4];
+		getSIPR(ip);
+		if ((ip[0] | ip[1] | ip[2] | ip[3]) == 0)
+			return SOCKERR_SOCKINIT;
+	} else if (protocol != Sn_MR_UDP) {
+		return SOCKERR_SOCKMODE;
+	}
+
+	close(sn);
+	setSn_MR(sn, (uint8_t)(protocol | (flag & 0xF0)));
+	if (!port) {
+		port = sock_any_port++;
+		if (sock_any_port == 0xFFF0)
+			sock_any_port = 0xC000;
+	}
+	setSn_PORT(sn, port);
+	setSn_CR(sn, Sn_CR_OPEN);
+	while (getSn_CR(sn))
+		;
+
+	sock_io_mode &= (uint16_t)~(1u << sn);
+	sock_io_mode |= (uint16_t)((flag & SF_IO_NONBLOCK) << sn);
+
+	while (getSn_SR(sn) == SOCK_CLOSED)
+		;
+	return (int8_t)sn;
+}
+
+int8_t close(uint8_t sn) {
+	CHECK_SOCKNUM();
+
+	setSn_CR(sn, Sn_CR_CLOSE);
+	while (getSn_CR(sn))
+		;
+	setSn_IR(sn, 0xFF);
+	sock_io_mode &= (uint16_t)~(1u << sn);
+	while (getSn_SR(sn) != SOCK_CLOSED)
+		;
+	return SOCK_OK;
+}
+
+int8_t listen(uint8_t sn) {
+	CHECK_SOCKNUM();
+
+	if ((getSn_MR(sn) & 0x0F) != Sn_MR_TCP)
+		return SOCKERR_SOCKMODE;
+	if (getSn_SR(sn) != SOCK_INIT)
+		return SOCKERR_SOCKINIT;
+
+	setSn_CR(sn, Sn_CR_LISTEN);
+	while (getSn_CR(sn))
+		;
+	while (getSn_SR(sn) != SOCK_LISTEN) {
+		close(sn);
+		return SOCKERR_SOCKCLOSED;
+	}
+	return SOCK_OK;
+}
+
+int8_t disconnect(uint8_t sn) {
+	CHECK_SOCKNUM();
+
+	if ((getSn_MR(sn) & 0x0F) != Sn_MR_TCP)
+		return SOCKERR_SOCKMODE;
+
+	setSn_CR(sn, Sn_CR_DISCON);
+	while (getSn_CR(sn))
+		;
+	if (sock_io_mode & (1u << sn))
+		return SOCK_BUSY;
+
+	// blocking mode is not used by the firmware
+	return SOCK_OK;
+}
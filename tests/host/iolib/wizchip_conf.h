@@ -0,0 +1,42 @@
+#pragma once
+
+// Host build only: the part of the WIZnet ioLibrary (Ethernet/wizchip_conf.h) the firmware
+// uses, same names and same SPI traffic, so the firmware runs unchanged against the simulated
+// W5500. The real library is not vendored in this tree.
+
+#include <stdint.h>
+
+#define W5500 5500
+#define _WIZCHIP_ W5500
+#define _WIZCHIP_SOCK_NUM_ 8
+
+typedef enum {
+	NETINFO_STATIC = 1,
+	NETINFO_DHCP,
+} dhcp_mode;
+
+typedef struct wiz_NetInfo_t {
+	uint8_t mac[6];
+	uint8_t ip[4];
+	uint8_t sn[4];
+	uint8_t gw[4];
+	uint8_t dns[4];
+	dhcp_mode dhcp;
+} wiz_NetInfo;
+
+typedef enum {
+	CN_SET_NETINFO,
+	CN_GET_NETINFO,
+} ctlnetwork_type;
+
+void reg_wizchip_cris_cbfunc(void (*cris_en)(void), void (*cris_ex)(void));
+void reg_wizchip_cs_cbfunc(void (*cs_sel)(void), void (*cs_desel)(void));
+void reg_wizchip_spi_cbfunc(uint8_t (*spi_rb)(void), void (*spi_wb)(uint8_t wb));
+void reg_wizchip_spiburst_cbfunc(void (*spi_rb)(uint8_t* pBuf, uint16_t len),
+	void (*spi_wb)(uint8_t* pBuf, uint16_t len));
+
+// txsize/rxsize in KB per socket, NULL keeps the chip's 2 KB. -1 if a direction exceeds 16 KB.
+int8_t wizchip_init(uint8_t* txsize, uint8_t* rxsize);
+int8_t ctlnetwork(ctlnetwork_type cntype, void* arg);
+
+#include "w5500.h"
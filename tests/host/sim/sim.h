@@ -0,0 +1,140 @@
+#pragma once
+
+// Host simulation of the board: a cooperative FreeRTOS stand-in on a simulated clock
+// (sim_rtos.c), the nRF52840 peripherals the firmware drives (sim_nrf.c) and a W5500 behind
+// SPIM3 with scripted TCP peers (sim_w5500.c). Tests link src/ against it unchanged.
+//
+// Task code takes no simulated time; the clock only moves while every task is blocked, to the
+// next hardware event or timeout. So what a test measures is bus and wire time plus the waits
+// the firmware chose, the same on every run and on every machine.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "FreeRTOS.h"
+#include "nrf52840.h"
+
+#define SIM_NS_PER_TICK 1000000ull
+
+/* ---------------- Run control (sim_rtos.c) ---------------- */
+
+// Before anything else: resets the clock and the event queue
+void sim_init(void);
+// From a task: stops the scheduler, vTaskStartScheduler() returns
+void sim_finish(void) __attribute__((noreturn));
+// Simulated time after which the run fails, default 60 s
+void sim_set_time_limit(uint64_t ns);
+
+uint64_t sim_now(void); // ns since sim_init()
+// From a task: sleeps for ns of simulated time, not rounded to ticks
+void sim_wait_ns(uint64_t ns);
+// Times task got the CPU, each wakeup counts once
+uint32_t sim_task_runs(TaskHandle_t task);
+// Host time task has run for, context switches included: compares builds, not boards
+uint64_t sim_task_cpu_ns(TaskHandle_t task);
+
+void sim_fail(const char* file, int line, const char* fmt, ...)
+	__attribute__((format(printf, 3, 4)));
+int sim_failures(void);
+
+#define SIM_CHECK(cond)                                                                            \
+	do {                                                                                       \
+		if (!(cond))                                                                       \
+			sim_fail(__FILE__, __LINE__, "%s", #cond);                                 \
+	} while (0)
+
+#define SIM_CHECK_EQ(a, b)                                                                         \
+	do {                                                                                       \
+		long long sim_a_ = (long long)(a);                                                 \
+		long long sim_b_ = (long long)(b);                                                 \
+		if (sim_a_ != sim_b_)                                                              \
+			sim_fail(__FILE__, __LINE__, "%s == %s (%lld != %lld)", #a, #b, sim_a_,   \
+				sim_b_);                                                           \
+	} while (0)
+
+/* ---------------- Hardware plumbing ---------------- */
+
+// fn(arg) runs at simulated time at, outside any task. Returns a handle for sim_cancel().
+typedef void (*sim_event_fn)(void* arg);
+uint32_t sim_at(uint64_t at, sim_event_fn fn, void* arg);
+void sim_cancel(uint32_t handle);
+
+// Pends irqn; runs now if the CPU is in a task outside a critical section
+void sim_irq_raise(IRQn_Type irqn);
+// sim_nrf.c: vector table and register polling, called by the scheduler
+void sim_irq_call(IRQn_Type irqn);
+void sim_hw_poll(void);
+
+/* ---------------- Peripherals (sim_nrf.c) ---------------- */
+
+// A device on a SPIM bus, selected while cs_pin is low. xfer gets one byte per SCK byte.
+typedef struct {
+	uint32_t cs_pin;
+	void (*select)(uint8_t selected);
+	uint8_t (*xfer)(uint8_t mosi);
+} sim_spi_dev_t;
+
+void sim_spi_attach(uint8_t spim, const sim_spi_dev_t* dev);
+
+// Called on every edge of pin, for models that watch an output (W5500 RSTn)
+void sim_pin_watch(uint32_t pin, void (*fn)(uint8_t level));
+// Drives an input pin (W5500 INTn), GPIOTE sees the edge
+void sim_pin_in(uint32_t pin, uint8_t level);
+
+typedef struct {
+	uint32_t starts;       // TASKS_START taken
+	uint32_t stops;	       // TASKS_STOP taken
+	uint64_t bytes;	       // clocked on SCK
+	uint64_t tx_dma;       // read by EasyDMA (TXD.MAXCNT)
+	uint64_t rx_dma;       // written by EasyDMA (RXD.MAXCNT)
+	uint64_t busy_ns;      // SCK running
+	uint32_t tx_clobbered; // TX buffer changed while EasyDMA was still reading it
+	uint32_t tx_ptrs[4];   // distinct TXD.PTR values seen (first 4)
+	uint8_t tx_ptr_count;  // more than 4: stays at 5
+} sim_spim_stats_t;
+
+const sim_spim_stats_t* sim_spim_stats(uint8_t spim);
+void sim_spim_stats_reset(uint8_t spim);
+// The next count transfers on spim never raise END, as a wedged peripheral
+void sim_spim_hang(uint8_t spim, uint32_t count);
+
+// Everything UARTE0 has put on the wire so far
+const uint8_t* sim_uart_output(size_t* len);
+
+/* ---------------- W5500 (sim_w5500.c) ---------------- */
+
+#define SIM_W5500_INT_PIN 29 // as wired in src/ports/w5500_port.c
+#define SIM_W5500_CS_PIN 30
+#define SIM_W5500_RST_PIN 31
+
+void sim_w5500_init(void);
+// Round trip to every peer, default 200 us. Wire speed is 100 Mbit/s.
+void sim_w5500_set_rtt(uint64_t ns);
+// Misuse the chip would not have reported: SEND with one in flight, Sn_TX_WR written during a
+// SEND, unknown commands. Each one is also printed.
+uint32_t sim_w5500_errors(void);
+uint32_t sim_w5500_frames(void); // SPI frames (CS windows) seen
+uint32_t sim_w5500_sends(uint8_t sn);
+
+// Scripted TCP peers. A connect finds the lowest socket in LISTEN on port; sends and closes
+// reach the chip in order, half a round trip later, as fast as its RX window takes them.
+typedef enum {
+	SIM_TCP_CONNECTING,
+	SIM_TCP_OPEN,
+	SIM_TCP_CLOSED,	 // both sides sent FIN
+	SIM_TCP_RESET,	 // socket closed under the connection
+	SIM_TCP_REFUSED, // nothing listening
+} sim_tcp_state_t;
+
+int sim_tcp_connect(uint16_t port);
+void sim_tcp_send(int peer, const void* data, size_t len);
+// FIN from the peer. A peer also answers the server's FIN with its own.
+void sim_tcp_close(int peer);
+sim_tcp_state_t sim_tcp_state(int peer);
+uint8_t sim_tcp_fin_received(int peer);
+// Bytes the server sent to peer so far
+const uint8_t* sim_tcp_received(int peer, size_t* len);
+
+// UDP datagrams the chip sent, in order
+uint32_t sim_udp_count(void);
+const uint8_t* sim_udp_get(uint32_t i, size_t* len, uint16_t* dport);
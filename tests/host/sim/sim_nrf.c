@@ -0,0 +1,433 @@
+// nRF52840 peripherals for the host simulation: SPIM0/SPIM3 with EasyDMA, UARTE0, GPIO outputs
+// and GPIOTE input events, and the vector table. Register writes are picked up by
+// sim_hw_poll(), which the scheduler runs before the clock moves.
+#include <stdio.h>
+#include <string.h>
+
+#include "board.h"
+#include "sim.h"
+
+// START to first SCK edge, EasyDMA setup included - a round figure, not a datasheet value
+#define SPIM_START_NS 500u
+#define SPIM_DEVS_MAX 4
+
+#define SPIM_INT_END (1u << 6)
+#define UARTE_INT_ENDTX (1u << 8)
+
+NRF_SPIM_Type sim_spim0;
+NRF_SPIM_Type sim_spim3;
+NRF_UARTE_Type sim_uarte0;
+NRF_GPIO_Type sim_p0;
+NRF_GPIOTE_Type sim_gpiote;
+
+void SPIM0_SPIS0_TWIM0_TWIS0_SPI0_TWI0_IRQHandler(void) __attribute__((weak));
+void SPIM3_IRQHandler(void) __attribute__((weak));
+void UARTE0_UART0_IRQHandler(void) __attribute__((weak));
+void GPIOTE_IRQHandler(void) __attribute__((weak));
+
+typedef struct {
+	NRF_SPIM_Type* regs;
+	IRQn_Type irqn;
+	uint8_t fast; // 16/32 MHz allowed
+	uint32_t inten;
+	uint8_t busy;
+	uint32_t end_ev;
+	uint32_t hang;
+
+	// transfer on the wire, latched at START like the real DMA registers
+	uint32_t tx_ptr;
+	uint32_t tx_cnt;
+	uint32_t rx_ptr;
+	uint32_t rx_cnt;
+	uint8_t orc;
+	uint8_t tx_copy[0xFFFF];
+
+	const sim_spi_dev_t* devs[SPIM_DEVS_MAX];
+	uint8_t dev_count;
+	sim_spim_stats_t stats;
+} spim_sim_t;
+
+static spim_sim_t spims[2] = {
+	{.regs = &sim_spim0, .irqn = SPIM0_SPIS0_TWIM0_TWIS0_SPI0_TWI0_IRQn, .fast = 0},
+	{.regs = &sim_spim3, .irqn = SPIM3_IRQn, .fast = 1},
+};
+
+static struct {
+	uint32_t inten;
+	uint8_t busy;
+	uint32_t end_ev;
+	uint8_t out[1u << 20];
+	size_t len;
+} uarte;
+
+static uint32_t gpiote_inten;
+
+#define PIN_WATCH_MAX 4
+static struct {
+	uint32_t pin;
+	void (*fn)(uint8_t level);
+} pin_watch[PIN_WATCH_MAX];
+static uint8_t pin_watch_count;
+
+static spim_sim_t* spim_of(uint8_t spim) {
+	configASSERT(spim == 0 || spim == 3);
+	return &spims[spim == 3];
+}
+
+/* ---------------- SPIM ---------------- */
+
+static uint32_t spim_hz(const spim_sim_t* s, uint32_t freq) {
+	switch (freq) {
+	case 0x02000000u:
+		return 125000;
+	case 0x04000000u:
+		return 250000;
+	case 0x08000000u:
+		return 500000;
+	case 0x10000000u:
+		return 1000000;
+	case 0x20000000u:
+		return 2000000;
+	case 0x40000000u:
+		return 4000000;
+	case 0x80000000u:
+		return 8000000;
+	case 0x0A000000u:
+		if (s->fast)
+			return 16000000;
+		break;
+	case 0x14000000u:
+		if (s->fast)
+			return 32000000;
+		break;
+	default:
+		break;
+	}
+
+	sim_fail(__FILE__, __LINE__, "SPIM%u: FREQUENCY 0x%08x not valid", s->fast ? 3u : 0u,
+		(unsigned)freq);
+	return 1000000;
+}
+
+static const sim_spi_dev_t* spim_selected(spim_sim_t* s) {
+	const sim_spi_dev_t* sel = NULL;
+
+	for (uint8_t i = 0; i < s->dev_count; i++) {
+		if (sim_p0.OUT & (1u << s->devs[i]->cs_pin))
+			continue;
+		if (sel != NULL)
+			sim_fail(__FILE__, __LINE__, "two SPI devices selected at once");
+		sel = s->devs[i];
+	}
+
+	return sel;
+}
+
+static void spim_end(void* arg) {
+	spim_sim_t* s = arg;
+	NRF_SPIM_Type* r = s->regs;
+	uint32_t n = (s->tx_cnt > s->rx_cnt) ? s->tx_cnt : s->rx_cnt;
+	const uint8_t* tx = (const uint8_t*)(uintptr_t)s->tx_ptr;
+	uint8_t* rx = (uint8_t*)(uintptr_t)s->rx_ptr;
+
+	// EasyDMA reads TX as the bytes go out: a CPU write meanwhile would have been sent
+	if (s->tx_cnt > 0 && memcmp(tx, s->tx_copy, s->tx_cnt) != 0) {
+		s->stats.tx_clobbered++;
+		sim_fail(__FILE__, __LINE__, "SPIM%u: TX buffer written during the transfer",
+			s->fast ? 3u : 0u);
+	}
+
+	const sim_spi_dev_t* dev = spim_selected(s);
+	for (uint32_t i = 0; i < n; i++) {
+		uint8_t mosi = (i < s->tx_cnt) ? s->tx_copy[i] : s->orc;
+		uint8_t miso = (dev != NULL) ? dev->xfer(mosi) : 0xFF;
+		if (i < s->rx_cnt)
+			rx[i] = miso;
+	}
+
+	s->busy = 0;
+	r->TXD.AMOUNT = s->tx_cnt;
+	r->RXD.AMOUNT = s->rx_cnt;
+	r->EVENTS_ENDTX = 1;
+	r->EVENTS_ENDRX = 1;
+	r->EVENTS_END = 1;
+
+	if (s->inten & SPIM_INT_END)
+		sim_irq_raise(s->irqn);
+}
+
+static void spim_note_tx_ptr(spim_sim_t* s, uint32_t ptr) {
+	sim_spim_stats_t* st = &s->stats;
+
+	for (uint8_t i = 0; i < st->tx_ptr_count && i < 4; i++) {
+		if (st->tx_ptrs[i] == ptr)
+			return;
+	}
+	if (st->tx_ptr_count < 4)
+		st->tx_ptrs[st->tx_ptr_count] = ptr;
+	if (st->tx_ptr_count < 5)
+		st->tx_ptr_count++;
+}
+
+static void spim_start(spim_sim_t* s) {
+	NRF_SPIM_Type* r = s->regs;
+
+	if (r->ENABLE != 7) {
+		sim_fail(__FILE__, __LINE__, "SPIM START while disabled");
+		return;
+	}
+	if (s->busy) {
+		sim_fail(__FILE__, __LINE__, "SPIM START during a transfer");
+		return;
+	}
+
+	s->tx_ptr = r->TXD.PTR;
+	s->tx_cnt = r->TXD.MAXCNT;
+	s->rx_ptr = r->RXD.PTR;
+	s->rx_cnt = r->RXD.MAXCNT;
+	s->orc = (uint8_t)r->ORC;
+	configASSERT(s->tx_cnt <= 0xFFFF && s->rx_cnt <= 0xFFFF);
+
+	if (s->tx_cnt > 0) {
+		memcpy(s->tx_copy, (const void*)(uintptr_t)s->tx_ptr, s->tx_cnt);
+		spim_note_tx_ptr(s, s->tx_ptr);
+	}
+
+	uint32_t n = (s->tx_cnt > s->rx_cnt) ? s->tx_cnt : s->rx_cnt;
+	uint64_t ns = SPIM_START_NS + (uint64_t)n * 8u * 1000000000u / spim_hz(s, r->FREQUENCY);
+
+	s->stats.starts++;
+	s->stats.bytes += n;
+	s->stats.tx_dma += s->tx_cnt;
+	s->stats.rx_dma += s->rx_cnt;
+	s->stats.busy_ns += ns;
+
+	r->EVENTS_STARTED = 1;
+	s->busy = 1;
+
+	if (s->hang > 0) {
+		s->hang--; // SCK never stops, END never comes
+		return;
+	}
+	s->end_ev = sim_at(sim_now() + ns, spim_end, s);
+}
+
+static void spim_stop(spim_sim_t* s) {
+	if (s->busy) {
+		sim_cancel(s->end_ev);
+		s->busy = 0;
+	}
+
+	s->stats.stops++;
+	s->regs->EVENTS_STOPPED = 1;
+}
+
+static void spim_poll(spim_sim_t* s) {
+	NRF_SPIM_Type* r = s->regs;
+
+	if (r->INTENCLR) {
+		s->inten &= ~r->INTENCLR;
+		r->INTENCLR = 0;
+	}
+	if (r->INTENSET) {
+		s->inten |= r->INTENSET;
+		r->INTENSET = 0;
+	}
+	if (r->TASKS_STOP) {
+		r->TASKS_STOP = 0;
+		spim_stop(s);
+	}
+	if (r->TASKS_START) {
+		r->TASKS_START = 0;
+		spim_start(s);
+	}
+}
+
+void sim_spi_attach(uint8_t spim, const sim_spi_dev_t* dev) {
+	spim_sim_t* s = spim_of(spim);
+	configASSERT(s->dev_count < SPIM_DEVS_MAX);
+	s->devs[s->dev_count++] = dev;
+	sim_p0.OUT |= (1u << dev->cs_pin); // pulled up until the firmware drives it
+}
+
+const sim_spim_stats_t* sim_spim_stats(uint8_t spim) {
+	return &spim_of(spim)->stats;
+}
+
+void sim_spim_stats_reset(uint8_t spim) {
+	memset(&spim_of(spim)->stats, 0, sizeof(sim_spim_stats_t));
+}
+
+void sim_spim_hang(uint8_t spim, uint32_t count) {
+	spim_of(spim)->hang = count;
+}
+
+/* ---------------- UARTE ---------------- */
+
+static void uarte_end(void* arg) {
+	(void)arg;
+	uint32_t n = sim_uarte0.TXD.MAXCNT;
+
+	configASSERT(uarte.len + n <= sizeof(uarte.out));
+	memcpy(uarte.out + uarte.len, (const void*)(uintptr_t)sim_uarte0.TXD.PTR, n);
+	uarte.len += n;
+
+	uarte.busy = 0;
+	sim_uarte0.TXD.AMOUNT = n;
+	sim_uarte0.EVENTS_ENDTX = 1;
+	if (uarte.inten & UARTE_INT_ENDTX)
+		sim_irq_raise(UARTE0_UART0_IRQn);
+}
+
+static void uarte_poll(void) {
+	NRF_UARTE_Type* r = &sim_uarte0;
+
+	if (r->INTENCLR) {
+		uarte.inten &= ~r->INTENCLR;
+		r->INTENCLR = 0;
+	}
+	if (r->INTENSET) {
+		uarte.inten |= r->INTENSET;
+		r->INTENSET = 0;
+	}
+	if (r->TASKS_STOPTX) {
+		r->TASKS_STOPTX = 0;
+		if (uarte.busy) {
+			sim_cancel(uarte.end_ev);
+			uarte.busy = 0;
+		}
+		r->EVENTS_TXSTOPPED = 1;
+	}
+	if (r->TASKS_STARTTX) {
+		r->TASKS_STARTTX = 0;
+		if (r->ENABLE != 8 || uarte.busy) {
+			sim_fail(__FILE__, __LINE__, "UARTE STARTTX while disabled or busy");
+			return;
+		}
+
+		// 10 bits a byte; BAUDRATE 0x10000000 is 1 Mbaud, the only rate the firmware uses
+		uint32_t baud = (r->BAUDRATE == 0x10000000u) ? 1000000u : 115200u;
+		uint64_t ns = (uint64_t)r->TXD.MAXCNT * 10u * 1000000000u / baud;
+		uarte.busy = 1;
+		uarte.end_ev = sim_at(sim_now() + ns, uarte_end, NULL);
+	}
+}
+
+const uint8_t* sim_uart_output(size_t* len) {
+	*len = uarte.len;
+	return uarte.out;
+}
+
+/* ---------------- GPIO / GPIOTE ---------------- */
+
+void sim_pin_out(uint32_t pin, uint8_t level) {
+	uint32_t bit = 1u << pin;
+	uint8_t old = (sim_p0.OUT & bit) != 0;
+
+	if (level)
+		sim_p0.OUT |= bit;
+	else
+		sim_p0.OUT &= ~bit;
+
+	if (old == level)
+		return;
+
+	for (uint8_t b = 0; b < 2; b++) {
+		spim_sim_t* s = &spims[b];
+		for (uint8_t i = 0; i < s->dev_count; i++) {
+			if (s->devs[i]->cs_pin != pin)
+				continue;
+			if (s->busy)
+				sim_fail(__FILE__, __LINE__, "CS %u moved during a transfer", (unsigned)pin);
+			if (s->devs[i]->select != NULL)
+				s->devs[i]->select(!level);
+		}
+	}
+
+	for (uint8_t i = 0; i < pin_watch_count; i++) {
+		if (pin_watch[i].pin == pin)
+			pin_watch[i].fn(level);
+	}
+}
+
+void sim_pin_watch(uint32_t pin, void (*fn)(uint8_t level)) {
+	configASSERT(pin_watch_count < PIN_WATCH_MAX);
+	pin_watch[pin_watch_count].pin = pin;
+	pin_watch[pin_watch_count].fn = fn;
+	pin_watch_count++;
+}
+
+void sim_pin_in(uint32_t pin, uint8_t level) {
+	uint32_t bit = 1u << pin;
+	uint8_t old = (sim_p0.IN & bit) != 0;
+
+	if (level)
+		sim_p0.IN |= bit;
+	else
+		sim_p0.IN &= ~bit;
+
+	if (old == level)
+		return;
+
+	for (uint8_t ch = 0; ch < 8; ch++) {
+		uint32_t cfg = sim_gpiote.CONFIG[ch];
+		uint32_t mode = cfg & 3u;
+		uint32_t psel = (cfg >> 8) & 0x1Fu;
+		uint32_t polarity = (cfg >> 16) & 3u; // 1 LoToHi, 2 HiToLo, 3 Toggle
+
+		if (mode != 1 || psel != pin)
+			continue;
+		if (polarity == 3 || (polarity == 1 && level) || (polarity == 2 && !level)) {
+			sim_gpiote.EVENTS_IN[ch] = 1;
+			if (gpiote_inten & (1u << ch))
+				sim_irq_raise(GPIOTE_IRQn);
+		}
+	}
+}
+
+static void gpiote_poll(void) {
+	if (sim_gpiote.INTENCLR) {
+		gpiote_inten &= ~sim_gpiote.INTENCLR;
+		sim_gpiote.INTENCLR = 0;
+	}
+	if (sim_gpiote.INTENSET) {
+		gpiote_inten |= sim_gpiote.INTENSET;
+		sim_gpiote.INTENSET = 0;
+	}
+}
+
+/* ---------------- Scheduler hooks ---------------- */
+
+void sim_hw_poll(void) {
+	spim_poll(&spims[0]);
+	spim_poll(&spims[1]);
+	uarte_poll();
+	gpiote_poll();
+}
+
+void sim_irq_call(IRQn_Type irqn) {
+	void (*handler)(void) = NULL;
+
+	switch (irqn) {
+	case SPIM0_SPIS0_TWIM0_TWIS0_SPI0_TWI0_IRQn:
+		handler = SPIM0_SPIS0_TWIM0_TWIS0_SPI0_TWI0_IRQHandler;
+		break;
+	case SPIM3_IRQn:
+		handler = SPIM3_IRQHandler;
+		break;
+	case UARTE0_UART0_IRQn:
+		handler = UARTE0_UART0_IRQHandler;
+		break;
+	case GPIOTE_IRQn:
+		handler = GPIOTE_IRQHandler;
+		break;
+	default:
+		break;
+	}
+
+	if (handler == NULL) {
+		sim_fail(__FILE__, __LINE__, "IRQ %d enabled without a handler", (int)irqn);
+		return;
+	}
+	handler();
+}
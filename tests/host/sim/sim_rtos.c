@@ -0,0 +1,675 @@
+// FreeRTOS stand-in for the host simulation: tasks on ucontext stacks, one at a time, switched
+// only where the firmware blocks. Simulated time jumps from one event to the next.
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <ucontext.h>
+
+#include "FreeRTOS.h"
+#include "semphr.h"
+#include "sim.h"
+#include "task.h"
+
+#define SIM_TASKS_MAX 16
+#define SIM_STACK_SIZE (256u * 1024u) // host frames are larger than Cortex-M ones
+#define SIM_EVENTS_MAX 256
+#define SIM_MUTEX_POOL 8
+#define NEVER UINT64_MAX
+
+#define SEM_BINARY 0
+#define SEM_MUTEX 1
+#define SEM_RECURSIVE 2
+
+typedef enum {
+	TASK_READY,
+	TASK_BLOCKED,
+	TASK_DEAD,
+} task_state_t;
+
+struct sim_task {
+	ucontext_t ctx;
+	TaskFunction_t fn;
+	void* arg;
+	const char* name;
+	UBaseType_t prio;
+	task_state_t state;
+	uint64_t seq;	  // FIFO order among equals: when it became ready, or started to wait
+	uint64_t wake_at; // timeout of the wait, NEVER for none
+	const volatile void* wait_on;
+	uint8_t woken; // wait ended by a give rather than the timeout
+	volatile uint32_t notify[configTASK_NOTIFICATION_ARRAY_ENTRIES];
+	uint32_t runs;
+	uint64_t cpu_ns; // host time spent running it, ISRs it ran into included
+};
+
+typedef struct {
+	uint64_t at;
+	uint64_t seq;
+	sim_event_fn fn;
+	void* arg;
+	uint32_t gen;
+} event_t;
+
+// Stacks in .bss: below 4 GB, so DMA pointers into them fit the 32 bit registers
+static uint8_t stacks[SIM_TASKS_MAX][SIM_STACK_SIZE] __attribute__((aligned(16)));
+static struct sim_task tasks[SIM_TASKS_MAX];
+static uint32_t task_count;
+
+static ucontext_t sched_ctx;
+static struct sim_task* cur;
+static uint8_t running;
+static uint8_t stop;
+
+static uint64_t now;
+static uint64_t seq;
+static uint64_t time_limit;
+static int failures;
+
+static event_t events[SIM_EVENTS_MAX];
+
+static uint32_t crit;
+static uint32_t in_isr;
+static uint8_t need_switch;
+static uint8_t irq_enabled[SIM_IRQ_COUNT];
+static uint8_t irq_pending[SIM_IRQ_COUNT];
+
+static StaticSemaphore_t mutex_pool[SIM_MUTEX_POOL];
+static uint32_t mutex_pool_used;
+
+void (*volatile sim_preempt_hook)(void);
+__thread volatile uint32_t* sim_excl_addr;
+__thread uint32_t sim_excl_val;
+
+/* ---------------- Failures ---------------- */
+
+static const char* cur_name(void) {
+	if (in_isr)
+		return "ISR";
+	return cur ? cur->name : "sim";
+}
+
+void sim_fail(const char* file, int line, const char* fmt, ...) {
+	va_list ap;
+
+	fprintf(stderr, "FAIL %s:%d [%.6f s, %s]: ", file, line, (double)now / 1e9, cur_name());
+	va_start(ap, fmt);
+	vfprintf(stderr, fmt, ap);
+	va_end(ap);
+	fputc('\n', stderr);
+	failures++;
+}
+
+int sim_failures(void) {
+	return failures;
+}
+
+void sim_assert_fail(const char* file, int line, const char* expr) {
+	fprintf(stderr, "ASSERT %s:%d [%.6f s, %s]: %s\n", file, line, (double)now / 1e9,
+		cur_name(), expr);
+	abort();
+}
+
+void sim_halt(const char* file, int line) {
+	fprintf(stderr, "HALT %s:%d [%.6f s, %s]: interrupts disabled for good\n", file, line,
+		(double)now / 1e9, cur_name());
+	abort();
+}
+
+/* ---------------- Clock and events ---------------- */
+
+void sim_init(void) {
+	now = 0;
+	seq = 0;
+	stop = 0;
+	time_limit = 60ull * 1000 * SIM_NS_PER_TICK;
+	for (uint32_t i = 0; i < SIM_EVENTS_MAX; i++)
+		events[i].fn = NULL;
+}
+
+void sim_set_time_limit(uint64_t ns) {
+	time_limit = ns;
+}
+
+uint64_t sim_now(void) {
+	return now;
+}
+
+uint32_t sim_at(uint64_t at, sim_event_fn fn, void* arg) {
+	if (at < now)
+		at = now;
+
+	for (uint32_t i = 0; i < SIM_EVENTS_MAX; i++) {
+		event_t* e = &events[i];
+		if (e->fn != NULL)
+			continue;
+
+		e->at = at;
+		e->seq = ++seq;
+		e->fn = fn;
+		e->arg = arg;
+		e->gen++;
+		return (e->gen << 8) | i;
+	}
+
+	sim_assert_fail(__FILE__, __LINE__, "event table full");
+}
+
+void sim_cancel(uint32_t handle) {
+	event_t* e = &events[handle & 0xFFu];
+	if (e->fn != NULL && e->gen == (handle >> 8))
+		e->fn = NULL;
+}
+
+// The earliest pending event, NULL if none
+static event_t* event_next(void) {
+	event_t* best = NULL;
+
+	for (uint32_t i = 0; i < SIM_EVENTS_MAX; i++) {
+		event_t* e = &events[i];
+		if (e->fn == NULL)
+			continue;
+		if (best == NULL || e->at < best->at || (e->at == best->at && e->seq < best->seq))
+			best = e;
+	}
+
+	return best;
+}
+
+static void events_run_due(void) {
+	for (;;) {
+		event_t* e = event_next();
+		if (e == NULL || e->at > now)
+			return;
+
+		sim_event_fn fn = e->fn;
+		void* arg = e->arg;
+		e->fn = NULL;
+		fn(arg);
+	}
+}
+
+/* ---------------- Scheduling ---------------- */
+
+static void irq_dispatch(void);
+static uint8_t irq_due(void);
+
+static void task_ready(struct sim_task* t) {
+	t->state = TASK_READY;
+	t->wait_on = NULL;
+	t->wake_at = NEVER;
+	t->seq = ++seq;
+}
+
+static struct sim_task* task_pick(void) {
+	struct sim_task* best = NULL;
+
+	for (uint32_t i = 0; i < task_count; i++) {
+		struct sim_task* t = &tasks[i];
+		if (t->state != TASK_READY)
+			continue;
+		if (best == NULL || t->prio > best->prio || (t->prio == best->prio && t->seq < best->seq))
+			best = t;
+	}
+
+	return best;
+}
+
+// Back to the scheduler; returns once cur is picked again
+static void task_switch_out(void) {
+	struct sim_task* t = cur;
+	swapcontext(&t->ctx, &sched_ctx);
+}
+
+// A task of higher priority than cur became ready: FreeRTOS would switch right away
+static void preempt_check(void) {
+	if (cur == NULL || crit || in_isr)
+		return;
+
+	struct sim_task* t = task_pick();
+	if (t != NULL && t->prio > cur->prio)
+		task_switch_out(); // cur stays ready and keeps its place
+}
+
+// Blocks cur on obj until woken or for ticks (portMAX_DELAY: forever). 1 if woken.
+static uint8_t task_block(const volatile void* obj, uint64_t wake_at) {
+	configASSERT(cur != NULL && !in_isr);
+	configASSERT(crit == 0); // FreeRTOS cannot block in a critical section either
+
+	cur->state = TASK_BLOCKED;
+	cur->wait_on = obj;
+	cur->wake_at = wake_at;
+	cur->woken = 0;
+	cur->seq = ++seq;
+	task_switch_out();
+	return cur->woken;
+}
+
+static uint64_t tick_deadline(TickType_t ticks) {
+	if (ticks == portMAX_DELAY)
+		return NEVER;
+	return (now / SIM_NS_PER_TICK + ticks) * SIM_NS_PER_TICK;
+}
+
+static void task_wake(struct sim_task* t) {
+	task_ready(t);
+	t->woken = 1;
+
+	if (in_isr || cur == NULL)
+		return; // ISR: portYIELD_FROM_ISR decides
+	if (crit)
+		need_switch = 1;
+	else
+		preempt_check();
+}
+
+// Highest priority task waiting on obj, longest waiting first
+static struct sim_task* waiter_of(const volatile void* obj) {
+	struct sim_task* best = NULL;
+
+	for (uint32_t i = 0; i < task_count; i++) {
+		struct sim_task* t = &tasks[i];
+		if (t->state != TASK_BLOCKED || t->wait_on != obj)
+			continue;
+		if (best == NULL || t->prio > best->prio || (t->prio == best->prio && t->seq < best->seq))
+			best = t;
+	}
+
+	return best;
+}
+
+static void task_entry(int idx) {
+	struct sim_task* t = &tasks[idx];
+	t->fn(t->arg);
+
+	sim_fail(__FILE__, __LINE__, "task %s returned", t->name);
+	vTaskDelete(NULL);
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn,
+	const char* name,
+	uint32_t stack_words,
+	void* arg,
+	UBaseType_t prio,
+	TaskHandle_t* handle) {
+	(void)stack_words;
+
+	if (task_count == SIM_TASKS_MAX)
+		return pdFAIL;
+	configASSERT(prio < configMAX_PRIORITIES + 1); // + 1: test drivers may sit above the firmware
+
+	uint32_t idx = task_count++;
+	struct sim_task* t = &tasks[idx];
+
+	getcontext(&t->ctx);
+	t->ctx.uc_stack.ss_sp = stacks[idx];
+	t->ctx.uc_stack.ss_size = sizeof(stacks[idx]);
+	t->ctx.uc_link = NULL;
+	makecontext(&t->ctx, (void (*)(void))task_entry, 1, (int)idx);
+
+	t->fn = fn;
+	t->arg = arg;
+	t->name = name;
+	t->prio = prio;
+	t->runs = 0;
+	t->cpu_ns = 0;
+	for (uint32_t i = 0; i < configTASK_NOTIFICATION_ARRAY_ENTRIES; i++)
+		t->notify[i] = 0;
+	task_ready(t);
+
+	if (handle != NULL)
+		*handle = t;
+
+	if (running && cur != NULL)
+		preempt_check();
+	return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t task) {
+	configASSERT(task == NULL || task == cur);
+	configASSERT(cur != NULL);
+
+	cur->state = TASK_DEAD;
+	task_switch_out();
+	sim_assert_fail(__FILE__, __LINE__, "dead task resumed");
+}
+
+void vTaskDelay(TickType_t ticks) {
+	if (ticks == 0) {
+		// yield to tasks of the same priority
+		task_ready(cur);
+		task_switch_out();
+		return;
+	}
+
+	(void)task_block(NULL, tick_deadline(ticks));
+}
+
+void sim_wait_ns(uint64_t ns) {
+	(void)task_block(NULL, now + ns);
+}
+
+TickType_t xTaskGetTickCount(void) {
+	return (TickType_t)(now / SIM_NS_PER_TICK);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void) {
+	return cur;
+}
+
+uint32_t sim_task_runs(TaskHandle_t task) {
+	return task->runs;
+}
+
+static uint64_t host_ns(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+uint64_t sim_task_cpu_ns(TaskHandle_t task) {
+	return task->cpu_ns;
+}
+
+void sim_finish(void) {
+	stop = 1;
+	configASSERT(cur != NULL);
+	cur->state = TASK_DEAD;
+	task_switch_out();
+	sim_assert_fail(__FILE__, __LINE__, "finished task resumed");
+}
+
+void vTaskStartScheduler(void) {
+	running = 1;
+
+	while (!stop) {
+		// hardware first: a TASKS_ write or an ISR may start something that ends later
+		for (;;) {
+			events_run_due();
+			sim_hw_poll();
+			if (!irq_due())
+				break;
+			irq_dispatch();
+		}
+
+		struct sim_task* t = task_pick();
+		if (t != NULL) {
+			cur = t;
+			t->runs++;
+			uint64_t t0 = host_ns();
+			swapcontext(&sched_ctx, &t->ctx);
+			t->cpu_ns += host_ns() - t0;
+			cur = NULL;
+			continue;
+		}
+
+		// everything waits: on to the next event or timeout
+		uint64_t next = NEVER;
+		event_t* e = event_next();
+		if (e != NULL)
+			next = e->at;
+		for (uint32_t i = 0; i < task_count; i++) {
+			if (tasks[i].state == TASK_BLOCKED && tasks[i].wake_at < next)
+				next = tasks[i].wake_at;
+		}
+
+		if (next == NEVER) {
+			sim_fail(__FILE__, __LINE__, "deadlock: every task waits forever");
+			break;
+		}
+		if (next > time_limit) {
+			sim_fail(__FILE__, __LINE__, "time limit of %.3f s reached",
+				(double)time_limit / 1e9);
+			break;
+		}
+
+		now = next;
+		events_run_due();
+		for (uint32_t i = 0; i < task_count; i++) {
+			struct sim_task* b = &tasks[i];
+			if (b->state == TASK_BLOCKED && b->wake_at <= now)
+				task_ready(b); // timed out, woken stays 0
+		}
+	}
+
+	running = 0;
+}
+
+/* ---------------- Interrupts and critical sections ---------------- */
+
+BaseType_t xPortIsInsideInterrupt(void) {
+	return in_isr ? pdTRUE : pdFALSE;
+}
+
+static uint8_t irq_due(void) {
+	for (uint32_t n = 0; n < SIM_IRQ_COUNT; n++) {
+		if (irq_pending[n] && irq_enabled[n])
+			return 1;
+	}
+	return 0;
+}
+
+static void irq_dispatch(void) {
+	if (crit || in_isr || !running)
+		return;
+
+	for (uint32_t n = 0; n < SIM_IRQ_COUNT; n++) {
+		if (!irq_pending[n] || !irq_enabled[n])
+			continue;
+
+		irq_pending[n] = 0;
+		in_isr++;
+		sim_irq_call((IRQn_Type)n);
+		in_isr--;
+		n = (uint32_t)-1;
+	}
+
+	if (need_switch) {
+		need_switch = 0;
+		preempt_check();
+	}
+}
+
+void sim_irq_raise(IRQn_Type irqn) {
+	irq_pending[irqn] = 1;
+
+	// from the scheduler (a hardware event) the loop dispatches it
+	if (cur != NULL)
+		irq_dispatch();
+}
+
+void NVIC_SetPriority(IRQn_Type irqn, uint32_t prio) {
+	(void)irqn;
+	(void)prio;
+}
+
+void NVIC_EnableIRQ(IRQn_Type irqn) {
+	irq_enabled[irqn] = 1;
+	if (cur != NULL)
+		irq_dispatch();
+}
+
+void NVIC_DisableIRQ(IRQn_Type irqn) {
+	irq_enabled[irqn] = 0;
+}
+
+void NVIC_SetPendingIRQ(IRQn_Type irqn) {
+	sim_irq_raise(irqn);
+}
+
+void NVIC_ClearPendingIRQ(IRQn_Type irqn) {
+	irq_pending[irqn] = 0;
+}
+
+void sim_critical_enter(void) {
+	crit++;
+}
+
+void sim_critical_exit(void) {
+	configASSERT(crit > 0);
+	if (--crit == 0)
+		irq_dispatch();
+}
+
+UBaseType_t sim_critical_enter_isr(void) {
+	crit++;
+	return 0;
+}
+
+void sim_critical_exit_isr(UBaseType_t saved) {
+	(void)saved;
+	configASSERT(crit > 0);
+	crit--;
+}
+
+void sim_yield_from_isr(BaseType_t woken) {
+	if (woken)
+		need_switch = 1;
+}
+
+/* ---------------- Notifications ---------------- */
+
+uint32_t ulTaskNotifyTakeIndexed(UBaseType_t index, BaseType_t clear, TickType_t ticks) {
+	configASSERT(index < configTASK_NOTIFICATION_ARRAY_ENTRIES);
+	struct sim_task* t = cur;
+
+	if (t->notify[index] == 0 && ticks != 0)
+		(void)task_block(&t->notify[index], tick_deadline(ticks));
+
+	uint32_t v = t->notify[index];
+	if (v != 0)
+		t->notify[index] = clear ? 0 : v - 1;
+	return v;
+}
+
+static uint8_t notify_give(TaskHandle_t task, UBaseType_t index) {
+	configASSERT(task != NULL && index < configTASK_NOTIFICATION_ARRAY_ENTRIES);
+
+	// producer threads of the logger stress test give with no scheduler running
+	__atomic_fetch_add(&task->notify[index], 1, __ATOMIC_SEQ_CST);
+	if (!running)
+		return 0;
+
+	if (task->state == TASK_BLOCKED && task->wait_on == &task->notify[index]) {
+		task_wake(task);
+		return cur == NULL || task->prio > cur->prio;
+	}
+	return 0;
+}
+
+BaseType_t xTaskNotifyGiveIndexed(TaskHandle_t task, UBaseType_t index) {
+	(void)notify_give(task, index);
+	return pdPASS;
+}
+
+void vTaskNotifyGiveIndexedFromISR(TaskHandle_t task, UBaseType_t index, BaseType_t* woken) {
+	if (notify_give(task, index) && woken != NULL)
+		*woken = pdTRUE;
+}
+
+/* ---------------- Semaphores ---------------- */
+
+static SemaphoreHandle_t sem_init(StaticSemaphore_t* s, uint8_t kind, uint8_t count) {
+	s->kind = kind;
+	s->count = count;
+	s->depth = 0;
+	s->owner = NULL;
+	return s;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinaryStatic(StaticSemaphore_t* buf) {
+	return sem_init(buf, SEM_BINARY, 0);
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutexStatic(StaticSemaphore_t* buf) {
+	return sem_init(buf, SEM_MUTEX, 1);
+}
+
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutexStatic(StaticSemaphore_t* buf) {
+	return sem_init(buf, SEM_RECURSIVE, 1);
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void) {
+	if (mutex_pool_used == SIM_MUTEX_POOL)
+		return NULL;
+	return sem_init(&mutex_pool[mutex_pool_used++], SEM_MUTEX, 1);
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks) {
+	configASSERT(sem != NULL && !in_isr);
+
+	if (sem->count) {
+		sem->count = 0;
+		sem->owner = cur;
+		return pdTRUE;
+	}
+	if (ticks == 0)
+		return pdFALSE;
+
+	// a give hands the semaphore straight to the waiter it wakes
+	return task_block(sem, tick_deadline(ticks)) ? pdTRUE : pdFALSE;
+}
+
+// 1 if it woke a task of higher priority than the running one
+static uint8_t sem_release(SemaphoreHandle_t sem) {
+	struct sim_task* w = waiter_of(sem);
+	if (w == NULL) {
+		sem->count = 1;
+		sem->owner = NULL;
+		return 0;
+	}
+
+	sem->owner = w;
+	task_wake(w);
+	return cur == NULL || w->prio > cur->prio;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem) {
+	configASSERT(sem != NULL);
+
+	if (sem->kind != SEM_BINARY)
+		configASSERT(sem->owner == cur);
+	else if (sem->count)
+		return pdFALSE;
+
+	(void)sem_release(sem);
+	return pdTRUE;
+}
+
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t sem, BaseType_t* woken) {
+	configASSERT(sem != NULL && sem->kind == SEM_BINARY);
+
+	if (sem->count)
+		return pdFALSE;
+
+	if (sem_release(sem) && woken != NULL)
+		*woken = pdTRUE;
+	return pdTRUE;
+}
+
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t sem, TickType_t ticks) {
+	configASSERT(sem != NULL && sem->kind == SEM_RECURSIVE);
+
+	if (sem->owner == cur && sem->count == 0) {
+		sem->depth++;
+		return pdTRUE;
+	}
+	if (xSemaphoreTake(sem, ticks) != pdTRUE)
+		return pdFALSE;
+
+	sem->depth = 1;
+	return pdTRUE;
+}
+
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t sem) {
+	configASSERT(sem != NULL && sem->kind == SEM_RECURSIVE);
+
+	if (sem->owner != cur || sem->depth == 0)
+		return pdFALSE;
+	if (--sem->depth > 0)
+		return pdTRUE;
+
+	// a waiter sets depth itself once its xSemaphoreTake() returns
+	(void)sem_release(sem);
+	return pdTRUE;
+}
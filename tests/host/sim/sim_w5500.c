@@ -0,0 +1,827 @@
+// W5500 behind SPIM3 for the host simulation: the SPI frame format (VDM only), the common and
+// socket registers the firmware and ioLibrary touch, the 16 KB TX and RX memories split by
+// Sn_TXBUF_SIZE/Sn_RXBUF_SIZE, and TCP/UDP on the other side of the wire. Commands finish at
+// once (Sn_CR always reads 0); what takes time is the wire: 80 ns a byte plus the round trip.
+//
+// Sn_TX_FSR counts from the Sn_TX_WR taken by the last SEND, Sn_RX_RSR from the Sn_RX_RD taken
+// by the last RECV - a pointer write alone frees nothing, as on the chip.
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sim.h"
+
+#define SOCKS 8
+#define PEERS_MAX 64
+#define MEM_SIZE 16384
+#define BYTE_NS 80ull	 // 100 Mbit/s
+#define UDP_SEND_NS 2000 // ARP cached, a datagram leaves right away
+
+// Sn_MR protocol, Sn_CR commands, Sn_SR states, Sn_IR bits
+#define MR_TCP 0x01
+#define MR_UDP 0x02
+
+#define CR_OPEN 0x01
+#define CR_LISTEN 0x02
+#define CR_DISCON 0x08
+#define CR_CLOSE 0x10
+#define CR_SEND 0x20
+#define CR_RECV 0x40
+
+#define SR_CLOSED 0x00
+#define SR_INIT 0x13
+#define SR_LISTEN 0x14
+#define SR_SYNRECV 0x16
+#define SR_ESTABLISHED 0x17
+#define SR_FIN_WAIT 0x18
+#define SR_CLOSE_WAIT 0x1C
+#define SR_LAST_ACK 0x1D
+#define SR_UDP 0x22
+
+#define IR_CON 0x01
+#define IR_DISCON 0x02
+#define IR_RECV 0x04
+#define IR_SENDOK 0x10
+
+// socket register offsets with behaviour of their own
+#define SN_MR 0x00
+#define SN_CR 0x01
+#define SN_IR 0x02
+#define SN_SR 0x03
+#define SN_PORT 0x04
+#define SN_DPORT 0x10
+#define SN_RXBUF_SIZE 0x1E
+#define SN_TXBUF_SIZE 0x1F
+#define SN_TX_FSR 0x20
+#define SN_TX_RD 0x22
+#define SN_TX_WR 0x24
+#define SN_RX_RSR 0x26
+#define SN_RX_RD 0x28
+#define SN_RX_WR 0x2A
+#define SN_IMR 0x2C
+
+// common register offsets
+#define C_MR 0x00
+#define C_SIR 0x17
+#define C_SIMR 0x18
+#define C_VERSIONR 0x39
+
+typedef struct {
+	uint8_t regs[0x30]; // as written, for the registers without a model of their own
+	uint8_t ir;
+	uint8_t sr;
+	uint16_t tx_rd;
+	uint16_t tx_wr_sent; // Sn_TX_WR at the last SEND
+	uint16_t rx_wr;
+	uint16_t rx_rd_taken; // Sn_RX_RD at the last RECV
+
+	uint8_t sending;
+	uint32_t send_ev;
+	uint64_t send_done_at;
+	uint8_t* send_data; // what the SEND in flight carries
+	uint16_t send_len;
+	uint32_t fin_ev;
+	uint8_t fin_ev_set;
+
+	int peer; // -1: none
+	uint32_t sends;
+} wsock_t;
+
+typedef struct {
+	uint8_t used;
+	sim_tcp_state_t state;
+	uint16_t port;
+	int sock; // -1 until the SYN lands
+	uint32_t ev;
+	uint8_t ev_set;
+
+	// toward the chip
+	uint8_t* out;
+	size_t out_len;
+	size_t out_head;
+	size_t out_cap;
+	uint8_t fin_out;
+	uint8_t fin_out_done;
+	uint64_t wire_free;
+	uint32_t deliver_len; // of the delivery in flight, 0 for the FIN
+
+	// from the chip
+	uint8_t* in;
+	size_t in_len;
+	size_t in_cap;
+	uint8_t fin_in;
+} peer_t;
+
+typedef struct {
+	uint8_t* data;
+	size_t len;
+	uint16_t dport;
+} dgram_t;
+
+static struct {
+	uint8_t common[0x40];
+	wsock_t socks[SOCKS];
+	uint8_t tx_mem[MEM_SIZE];
+	uint8_t rx_mem[MEM_SIZE];
+
+	// frame decoder
+	uint8_t selected;
+	uint32_t frame_pos;
+	uint16_t addr;
+	uint8_t ctrl;
+
+	uint64_t rtt;
+	uint32_t errors;
+	uint32_t frames;
+} chip;
+
+static peer_t peers[PEERS_MAX];
+static dgram_t* dgrams;
+static uint32_t dgram_count;
+
+static void werr(const char* fmt, ...) __attribute__((format(printf, 1, 2)));
+
+static void werr(const char* fmt, ...) {
+	va_list ap;
+
+	chip.errors++;
+	fprintf(stderr, "[%10.3f ms] W5500: ", (double)sim_now() / 1e6);
+	va_start(ap, fmt);
+	vfprintf(stderr, fmt, ap);
+	va_end(ap);
+	fputc('\n', stderr);
+}
+
+static void* grow(void* p, size_t* cap, size_t need) {
+	if (need <= *cap)
+		return p;
+
+	size_t n = (*cap > 0) ? *cap : 256;
+	while (n < need)
+		n *= 2;
+	p = realloc(p, n);
+	configASSERT(p != NULL);
+	*cap = n;
+	return p;
+}
+
+static uint16_t rd16(const uint8_t* p) {
+	return (uint16_t)((p[0] << 8) | p[1]);
+}
+
+/* ---------------- Memories ---------------- */
+
+static uint32_t buf_size(const wsock_t* s, uint8_t reg) {
+	return (uint32_t)s->regs[reg] * 1024u;
+}
+
+static uint32_t buf_base(uint8_t sn, uint8_t reg) {
+	uint32_t base = 0;
+	for (uint8_t i = 0; i < sn; i++)
+		base += buf_size(&chip.socks[i], reg);
+	return base;
+}
+
+// Address of byte off of the TX (reg SN_TXBUF_SIZE) or RX memory of sn, -1 if it has none
+static int32_t mem_at(uint8_t sn, uint8_t reg, uint16_t off) {
+	uint32_t size = buf_size(&chip.socks[sn], reg);
+	uint32_t base = buf_base(sn, reg);
+
+	if (size == 0 || base + size > MEM_SIZE)
+		return -1;
+	return (int32_t)(base + (off & (size - 1)));
+}
+
+static uint16_t tx_fsr(const wsock_t* s) {
+	return (uint16_t)(buf_size(s, SN_TXBUF_SIZE) - (uint16_t)(s->tx_wr_sent - s->tx_rd));
+}
+
+static uint16_t rx_rsr(const wsock_t* s) {
+	return (uint16_t)(s->rx_wr - s->rx_rd_taken);
+}
+
+/* ---------------- Interrupts ---------------- */
+
+static uint8_t sir(void) {
+	uint8_t v = 0;
+	for (uint8_t sn = 0; sn < SOCKS; sn++) {
+		if (chip.socks[sn].ir)
+			v |= (uint8_t)(1u << sn);
+	}
+	return v;
+}
+
+static void int_update(void) {
+	sim_pin_in(SIM_W5500_INT_PIN, (sir() & chip.common[C_SIMR]) ? 0 : 1);
+}
+
+// Sn_IR latches only the events Sn_IMR lets through
+static void sock_event(wsock_t* s, uint8_t bit) {
+	if (s->regs[SN_IMR] & bit) {
+		s->ir |= bit;
+		int_update();
+	}
+}
+
+/* ---------------- TCP peers ---------------- */
+
+static void peer_cancel(peer_t* p) {
+	if (p->ev_set) {
+		sim_cancel(p->ev);
+		p->ev_set = 0;
+	}
+}
+
+static void peer_pump(peer_t* p, uint64_t delay);
+
+static void peer_deliver(void* arg) {
+	peer_t* p = arg;
+	wsock_t* s = &chip.socks[p->sock];
+	uint8_t sn = (uint8_t)p->sock;
+
+	p->ev_set = 0;
+
+	if (p->deliver_len > 0) {
+		for (uint32_t i = 0; i < p->deliver_len; i++) {
+			int32_t at = mem_at(sn, SN_RXBUF_SIZE, (uint16_t)(s->rx_wr + i));
+			if (at >= 0)
+				chip.rx_mem[at] = p->out[p->out_head + i];
+		}
+		p->out_head += p->deliver_len;
+		s->rx_wr = (uint16_t)(s->rx_wr + p->deliver_len);
+		sock_event(s, IR_RECV);
+		peer_pump(p, 0);
+		return;
+	}
+
+	// the peer's FIN
+	p->fin_out_done = 1;
+	if (s->sr == SR_ESTABLISHED) {
+		s->sr = SR_CLOSE_WAIT;
+		sock_event(s, IR_DISCON);
+	} else if (s->sr == SR_FIN_WAIT && !s->fin_ev_set) {
+		// both FINs are through; TIME_WAIT is not modelled
+		s->sr = SR_CLOSED;
+		s->peer = -1;
+		p->state = SIM_TCP_CLOSED;
+		sock_event(s, IR_DISCON);
+	}
+}
+
+// Sends what the peer has queued once the window has room, in order. delay is how long after
+// now the first byte can be at the chip.
+static void peer_pump(peer_t* p, uint64_t delay) {
+	if (p->ev_set || p->sock < 0 || p->state != SIM_TCP_OPEN)
+		return;
+
+	wsock_t* s = &chip.socks[p->sock];
+	if (s->sr != SR_ESTABLISHED && s->sr != SR_FIN_WAIT)
+		return;
+
+	size_t queued = p->out_len - p->out_head;
+	uint32_t n = 0;
+
+	if (queued > 0) {
+		uint32_t window = buf_size(s, SN_RXBUF_SIZE) - rx_rsr(s);
+		n = (queued < window) ? (uint32_t)queued : window;
+		if (n == 0)
+			return; // RECV pumps again
+	} else if (!p->fin_out || p->fin_out_done) {
+		return;
+	}
+
+	uint64_t at = sim_now() + delay;
+	if (at < p->wire_free)
+		at = p->wire_free;
+	at += n * BYTE_NS;
+
+	p->wire_free = at;
+	p->deliver_len = n;
+	p->ev = sim_at(at, peer_deliver, p);
+	p->ev_set = 1;
+}
+
+static void sock_established(void* arg) {
+	peer_t* p = arg;
+	wsock_t* s = &chip.socks[p->sock];
+
+	p->ev_set = 0;
+	s->sr = SR_ESTABLISHED;
+	sock_event(s, IR_CON);
+	peer_pump(p, 0); // sent right behind the ACK
+}
+
+static void peer_synack(void* arg) {
+	peer_t* p = arg;
+
+	p->state = SIM_TCP_OPEN;
+	p->ev = sim_at(sim_now() + chip.rtt / 2, sock_established, p);
+	p->ev_set = 1;
+}
+
+static void peer_syn(void* arg) {
+	peer_t* p = arg;
+
+	p->ev_set = 0;
+	for (uint8_t sn = 0; sn < SOCKS; sn++) {
+		wsock_t* s = &chip.socks[sn];
+		if (s->sr != SR_LISTEN || rd16(&s->regs[SN_PORT]) != p->port)
+			continue;
+
+		s->sr = SR_SYNRECV;
+		s->peer = (int)(p - peers);
+		p->sock = sn;
+		p->ev = sim_at(sim_now() + chip.rtt / 2, peer_synack, p);
+		p->ev_set = 1;
+		return;
+	}
+
+	p->state = SIM_TCP_REFUSED;
+}
+
+int sim_tcp_connect(uint16_t port) {
+	for (int i = 0; i < PEERS_MAX; i++) {
+		peer_t* p = &peers[i];
+		if (p->used)
+			continue;
+
+		memset(p, 0, sizeof(*p));
+		p->used = 1;
+		p->state = SIM_TCP_CONNECTING;
+		p->port = port;
+		p->sock = -1;
+		p->ev = sim_at(sim_now() + chip.rtt / 2, peer_syn, p);
+		p->ev_set = 1;
+		return i;
+	}
+
+	configASSERT(0);
+	return -1;
+}
+
+void sim_tcp_send(int peer, const void* data, size_t len) {
+	peer_t* p = &peers[peer];
+
+	configASSERT(p->used && !p->fin_out);
+	p->out = grow(p->out, &p->out_cap, p->out_len + len);
+	memcpy(p->out + p->out_len, data, len);
+	p->out_len += len;
+	peer_pump(p, chip.rtt / 2);
+}
+
+void sim_tcp_close(int peer) {
+	peer_t* p = &peers[peer];
+
+	configASSERT(p->used);
+	if (p->fin_out)
+		return;
+	p->fin_out = 1;
+	peer_pump(p, chip.rtt / 2);
+}
+
+sim_tcp_state_t sim_tcp_state(int peer) {
+	return peers[peer].state;
+}
+
+uint8_t sim_tcp_fin_received(int peer) {
+	return peers[peer].fin_in;
+}
+
+const uint8_t* sim_tcp_received(int peer, size_t* len) {
+	*len = peers[peer].in_len;
+	return peers[peer].in;
+}
+
+// The socket went away under the connection (CLOSE, OPEN, reset)
+static void sock_drop_peer(wsock_t* s) {
+	if (s->peer < 0)
+		return;
+
+	peer_t* p = &peers[s->peer];
+	peer_cancel(p);
+	if (p->state == SIM_TCP_OPEN || p->state == SIM_TCP_CONNECTING)
+		p->state = SIM_TCP_RESET;
+	p->sock = -1;
+	s->peer = -1;
+}
+
+/* ---------------- Commands ---------------- */
+
+static void sock_cancel(wsock_t* s) {
+	if (s->sending) {
+		sim_cancel(s->send_ev);
+		s->sending = 0;
+	}
+	if (s->fin_ev_set) {
+		sim_cancel(s->fin_ev);
+		s->fin_ev_set = 0;
+	}
+}
+
+static void send_done(void* arg) {
+	wsock_t* s = arg;
+
+	s->sending = 0;
+	s->tx_rd = s->tx_wr_sent;
+	s->sends++;
+
+	if (s->sr == SR_UDP) {
+		dgrams = realloc(dgrams, (dgram_count + 1) * sizeof(dgram_t));
+		configASSERT(dgrams != NULL);
+		dgrams[dgram_count].data = s->send_data;
+		dgrams[dgram_count].len = s->send_len;
+		dgrams[dgram_count].dport = rd16(&s->regs[SN_DPORT]);
+		dgram_count++;
+		s->send_data = NULL;
+	} else if (s->peer >= 0) {
+		// the peer sees the data with the ACK that makes SENDOK, half a round trip early
+		peer_t* p = &peers[s->peer];
+		p->in = grow(p->in, &p->in_cap, p->in_len + s->send_len);
+		memcpy(p->in + p->in_len, s->send_data, s->send_len);
+		p->in_len += s->send_len;
+	}
+
+	sock_event(s, IR_SENDOK);
+}
+
+static void cmd_send(uint8_t sn, wsock_t* s) {
+	if (s->sending) {
+		werr("sock %u: SEND with a SEND in flight", sn);
+		return;
+	}
+	if (s->sr != SR_ESTABLISHED && s->sr != SR_CLOSE_WAIT && s->sr != SR_UDP) {
+		werr("sock %u: SEND in state 0x%02x", sn, s->sr);
+		return;
+	}
+
+	uint16_t wr = rd16(&s->regs[SN_TX_WR]);
+	uint16_t len = (uint16_t)(wr - s->tx_rd);
+	if (len > buf_size(s, SN_TXBUF_SIZE)) {
+		werr("sock %u: SEND of %u bytes, more than the TX memory", sn, len);
+		return;
+	}
+
+	free(s->send_data);
+	s->send_data = malloc(len ? len : 1);
+	configASSERT(s->send_data != NULL);
+	for (uint16_t i = 0; i < len; i++) {
+		int32_t at = mem_at(sn, SN_TXBUF_SIZE, (uint16_t)(s->tx_rd + i));
+		s->send_data[i] = (at >= 0) ? chip.tx_mem[at] : 0;
+	}
+	s->send_len = len;
+	s->tx_wr_sent = wr;
+
+	uint64_t ns = len * BYTE_NS + ((s->sr == SR_UDP) ? UDP_SEND_NS : chip.rtt);
+	s->sending = 1;
+	s->send_done_at = sim_now() + ns;
+	s->send_ev = sim_at(s->send_done_at, send_done, s);
+}
+
+static void last_ack_done(void* arg) {
+	wsock_t* s = arg;
+
+	s->fin_ev_set = 0;
+	s->sr = SR_CLOSED;
+	sock_event(s, IR_DISCON);
+}
+
+// Our FIN reaches the peer
+static void fin_to_peer(void* arg) {
+	wsock_t* s = arg;
+	peer_t* p = &peers[s->peer];
+
+	s->fin_ev_set = 0;
+	p->fin_in = 1;
+
+	if (s->sr == SR_LAST_ACK) {
+		p->state = SIM_TCP_CLOSED;
+		s->peer = -1;
+		s->fin_ev = sim_at(sim_now() + chip.rtt / 2, last_ack_done, s);
+		s->fin_ev_set = 1;
+	} else if (p->fin_out_done) {
+		// simultaneous close: theirs landed while ours was on the way
+		p->state = SIM_TCP_CLOSED;
+		s->peer = -1;
+		s->sr = SR_CLOSED;
+		sock_event(s, IR_DISCON);
+	} else {
+		sim_tcp_close((int)(p - peers)); // the peer answers with its own FIN
+	}
+}
+
+static void cmd_discon(wsock_t* s) {
+	if (s->sr == SR_ESTABLISHED)
+		s->sr = SR_FIN_WAIT;
+	else if (s->sr == SR_CLOSE_WAIT)
+		s->sr = SR_LAST_ACK;
+	else
+		return;
+
+	// the FIN goes out behind the data of a SEND in flight
+	uint64_t at = sim_now();
+	if (s->sending && s->send_done_at > at)
+		at = s->send_done_at;
+	s->fin_ev = sim_at(at + chip.rtt / 2, fin_to_peer, s);
+	s->fin_ev_set = 1;
+}
+
+static void sock_command(uint8_t sn, uint8_t cmd) {
+	wsock_t* s = &chip.socks[sn];
+
+	switch (cmd) {
+	case CR_OPEN:
+		sock_cancel(s);
+		sock_drop_peer(s);
+		s->tx_rd = 0;
+		s->tx_wr_sent = 0;
+		s->regs[SN_TX_WR] = 0;
+		s->regs[SN_TX_WR + 1] = 0;
+		s->rx_wr = 0;
+		s->rx_rd_taken = 0;
+		s->regs[SN_RX_RD] = 0;
+		s->regs[SN_RX_RD + 1] = 0;
+		if ((s->regs[SN_MR] & 0x0F) == MR_TCP)
+			s->sr = SR_INIT;
+		else if ((s->regs[SN_MR] & 0x0F) == MR_UDP)
+			s->sr = SR_UDP;
+		else
+			werr("sock %u: OPEN with Sn_MR 0x%02x", sn, s->regs[SN_MR]);
+		break;
+
+	case CR_LISTEN:
+		if (s->sr == SR_INIT)
+			s->sr = SR_LISTEN;
+		else
+			werr("sock %u: LISTEN in state 0x%02x", sn, s->sr);
+		break;
+
+	case CR_DISCON:
+		cmd_discon(s);
+		break;
+
+	case CR_CLOSE:
+		sock_cancel(s);
+		sock_drop_peer(s);
+		s->sr = SR_CLOSED;
+		break;
+
+	case CR_SEND:
+		cmd_send(sn, s);
+		break;
+
+	case CR_RECV:
+		s->rx_rd_taken = rd16(&s->regs[SN_RX_RD]);
+		if (rx_rsr(s) > buf_size(s, SN_RXBUF_SIZE))
+			werr("sock %u: Sn_RX_RD moved past Sn_RX_WR", sn);
+		if (s->peer >= 0)
+			peer_pump(&peers[s->peer], chip.rtt); // window update there, data back
+		break;
+
+	default:
+		werr("sock %u: unknown command 0x%02x", sn, cmd);
+		break;
+	}
+}
+
+/* ---------------- Registers ---------------- */
+
+static void sock_reset(wsock_t* s) {
+	sock_cancel(s);
+	sock_drop_peer(s);
+	free(s->send_data);
+
+	uint32_t sends = s->sends;
+	memset(s, 0, sizeof(*s));
+	s->sends = sends;
+	s->peer = -1;
+	s->regs[SN_RXBUF_SIZE] = 2;
+	s->regs[SN_TXBUF_SIZE] = 2;
+	s->regs[SN_IMR] = 0xFF;
+	s->regs[0x16] = 0x80; // TTL
+}
+
+static void chip_reset(void) {
+	memset(chip.common, 0, sizeof(chip.common));
+	chip.common[0x19] = 0x07; // RTR 2000 (200 ms)
+	chip.common[0x1A] = 0xD0;
+	chip.common[0x1B] = 0x08; // RCR
+	chip.common[0x2E] = 0xBF; // PHYCFGR: link up, 100 Mbit/s full duplex
+	chip.common[C_VERSIONR] = 0x04;
+
+	for (uint8_t sn = 0; sn < SOCKS; sn++)
+		sock_reset(&chip.socks[sn]);
+	int_update();
+}
+
+static uint8_t common_read(uint16_t addr) {
+	if (addr == C_SIR)
+		return sir();
+	return (addr < sizeof(chip.common)) ? chip.common[addr] : 0;
+}
+
+static void common_write(uint16_t addr, uint8_t v) {
+	if (addr >= sizeof(chip.common))
+		return;
+
+	if (addr == C_MR && (v & 0x80)) {
+		chip_reset();
+		return;
+	}
+	if (addr == C_SIR || addr == C_VERSIONR || addr == 0x2E)
+		return; // read only here
+
+	chip.common[addr] = v;
+	if (addr == C_SIMR)
+		int_update();
+}
+
+static uint8_t sock_read(uint8_t sn, uint16_t addr) {
+	wsock_t* s = &chip.socks[sn];
+
+	switch (addr) {
+	case SN_CR:
+		return 0;
+	case SN_IR:
+		return s->ir;
+	case SN_SR:
+		return s->sr;
+	case SN_TX_FSR:
+		return (uint8_t)(tx_fsr(s) >> 8);
+	case SN_TX_FSR + 1:
+		return (uint8_t)tx_fsr(s);
+	case SN_TX_RD:
+		return (uint8_t)(s->tx_rd >> 8);
+	case SN_TX_RD + 1:
+		return (uint8_t)s->tx_rd;
+	case SN_RX_RSR:
+		return (uint8_t)(rx_rsr(s) >> 8);
+	case SN_RX_RSR + 1:
+		return (uint8_t)rx_rsr(s);
+	case SN_RX_WR:
+		return (uint8_t)(s->rx_wr >> 8);
+	case SN_RX_WR + 1:
+		return (uint8_t)s->rx_wr;
+	default:
+		return (addr < sizeof(s->regs)) ? s->regs[addr] : 0;
+	}
+}
+
+static void sock_write(uint8_t sn, uint16_t addr, uint8_t v) {
+	wsock_t* s = &chip.socks[sn];
+
+	switch (addr) {
+	case SN_CR:
+		sock_command(sn, v);
+		return;
+	case SN_IR:
+		s->ir &= (uint8_t)~v;
+		int_update();
+		return;
+	case SN_SR:
+	case SN_TX_FSR:
+	case SN_TX_FSR + 1:
+	case SN_TX_RD:
+	case SN_TX_RD + 1:
+	case SN_RX_RSR:
+	case SN_RX_RSR + 1:
+	case SN_RX_WR:
+	case SN_RX_WR + 1:
+		return; // read only
+	case SN_TX_WR:
+	case SN_TX_WR + 1:
+		if (s->sending)
+			werr("sock %u: Sn_TX_WR written during a SEND", sn);
+		break;
+	case SN_TXBUF_SIZE:
+	case SN_RXBUF_SIZE:
+		if (v > 16 || (v & (v - 1)) != 0)
+			werr("sock %u: buffer size %u KB", sn, v);
+		break;
+	default:
+		break;
+	}
+
+	if (addr < sizeof(s->regs))
+		s->regs[addr] = v;
+}
+
+// One data byte of a frame, at the address the frame has reached
+static uint8_t frame_byte(uint8_t mosi) {
+	uint8_t bsb = chip.ctrl >> 3;
+	uint8_t write = (chip.ctrl & 0x04) != 0;
+	uint16_t addr = chip.addr++;
+	uint8_t miso = 0;
+
+	if (bsb == 0) {
+		if (write)
+			common_write(addr, mosi);
+		else
+			miso = common_read(addr);
+		return miso;
+	}
+
+	uint8_t sn = (uint8_t)((bsb - 1) >> 2);
+	uint8_t kind = (uint8_t)((bsb - 1) & 3); // 0 registers, 1 TX memory, 2 RX memory
+	if (kind == 0) {
+		if (write)
+			sock_write(sn, addr, mosi);
+		else
+			miso = sock_read(sn, addr);
+		return miso;
+	}
+	if (kind == 3) {
+		werr("reserved block 0x%02x", bsb);
+		return 0;
+	}
+
+	uint8_t reg = (kind == 1) ? SN_TXBUF_SIZE : SN_RXBUF_SIZE;
+	uint8_t* mem = (kind == 1) ? chip.tx_mem : chip.rx_mem;
+	int32_t at = mem_at(sn, reg, addr);
+	if (at < 0) {
+		werr("sock %u: access to a buffer of 0 KB", sn);
+		return 0;
+	}
+	if (write)
+		mem[at] = mosi;
+	else
+		miso = mem[at];
+	return miso;
+}
+
+static void spi_select(uint8_t selected) {
+	if (!selected && chip.frame_pos != 0 && chip.frame_pos < 3)
+		werr("frame cut inside its header");
+
+	chip.selected = selected;
+	chip.frame_pos = 0;
+	if (selected)
+		chip.frames++;
+}
+
+static uint8_t spi_xfer(uint8_t mosi) {
+	uint32_t pos = chip.frame_pos++;
+
+	switch (pos) {
+	case 0:
+		chip.addr = (uint16_t)(mosi << 8);
+		return 0x01;
+	case 1:
+		chip.addr |= mosi;
+		return 0x02;
+	case 2:
+		chip.ctrl = mosi;
+		if ((mosi & 0x03) != 0)
+			werr("fixed length mode (OM %u), only VDM is used", mosi & 0x03);
+		return 0x03;
+	default:
+		return frame_byte(mosi);
+	}
+}
+
+static void rst_pin(uint8_t level) {
+	if (level == 0)
+		chip_reset();
+}
+
+static const sim_spi_dev_t w5500_spi = {
+	.cs_pin = SIM_W5500_CS_PIN,
+	.select = spi_select,
+	.xfer = spi_xfer,
+};
+
+void sim_w5500_init(void) {
+	chip.rtt = 200000;
+	chip_reset();
+	sim_spi_attach(3, &w5500_spi);
+	sim_pin_watch(SIM_W5500_RST_PIN, rst_pin);
+}
+
+void sim_w5500_set_rtt(uint64_t ns) {
+	chip.rtt = ns;
+}
+
+uint32_t sim_w5500_errors(void) {
+	return chip.errors;
+}
+
+uint32_t sim_w5500_frames(void) {
+	return chip.frames;
+}
+
+uint32_t sim_w5500_sends(uint8_t sn) {
+	configASSERT(sn < SOCKS);
+	return chip.socks[sn].sends;
+}
+
+uint32_t sim_udp_count(void) {
+	return dgram_count;
+}
+
+const uint8_t* sim_udp_get(uint32_t i, size_t* len, uint16_t* dport) {
+	configASSERT(i < dgram_count);
+	*len = dgrams[i].len;
+	if (dport != NULL)
+		*dport = dgrams[i].dport;
+	return dgrams[i].data;
+}
@@ -0,0 +1,385 @@
+// http.c on its own: a corpus of request heads as browsers and tools send them, each fed whole
+// and split at every byte boundary, must parse to the same result; malformed heads must be
+// refused however they are split. Ends with the parse rate over the corpus.
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "modules/http.h"
+#include "modules/net.h"
+#include "sim.h"
+
+typedef struct {
+	const char* name;
+	const char* text;
+	http_method_t method;
+	const char* target;
+	uint8_t version_minor;
+	const char* host;
+	uint32_t content_length;
+	int keep_alive;
+} capture_t;
+
+static const capture_t corpus[] = {
+	{"chrome", "GET / HTTP/1.1\r\n"
+		   "Host: 192.168.1.50\r\n"
+		   "Connection: keep-alive\r\n"
+		   "Upgrade-Insecure-Requests: 1\r\n"
+		   "User-Agent: Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 (KHTML, like Gecko) "
+		   "Chrome/126.0.0.0 Safari/537.36\r\n"
+		   "Accept: text/html,application/xhtml+xml,application/xml;q=0.9,image/avif,"
+		   "image/webp,image/apng,*/*;q=0.8\r\n"
+		   "Accept-Encoding: gzip, deflate\r\n"
+		   "Accept-Language: en-US,en;q=0.9\r\n"
+		   "\r\n",
+		HTTP_METHOD_GET, "/", 1, "192.168.1.50", 0, 1},
+	{"firefox", "GET /app.js HTTP/1.1\r\n"
+		    "Host: 192.168.1.50\r\n"
+		    "User-Agent: Mozilla/5.0 (X11; Linux x86_64; rv:127.0) Gecko/20100101 "
+		    "Firefox/127.0\r\n"
+		    "Accept: */*\r\n"
+		    "Accept-Language: en-US,en;q=0.5\r\n"
+		    "Accept-Encoding: gzip, deflate\r\n"
+		    "Connection: keep-alive\r\n"
+		    "Referer: http://192.168.1.50/\r\n"
+		    "If-None-Match: \"5f3a9c1e\"\r\n"
+		    "Priority: u=2\r\n"
+		    "\r\n",
+		HTTP_METHOD_GET, "/app.js", 1, "192.168.1.50", 0, 1},
+	{"curl", "GET /health HTTP/1.1\r\n"
+		 "Host: board.local\r\n"
+		 "User-Agent: curl/8.5.0\r\n"
+		 "Accept: */*\r\n"
+		 "\r\n",
+		HTTP_METHOD_GET, "/health", 1, "board.local", 0, 1},
+	{"curl -I", "HEAD /style.css HTTP/1.1\r\n"
+		    "Host: board.local:80\r\n"
+		    "User-Agent: curl/8.5.0\r\n"
+		    "Accept: */*\r\n"
+		    "\r\n",
+		HTTP_METHOD_HEAD, "/style.css", 1, "board.local:80", 0, 1},
+	{"curl range", "GET /index.html HTTP/1.1\r\n"
+		       "Host: board.local\r\n"
+		       "Range: bytes=100-199\r\n"
+		       "User-Agent: curl/8.5.0\r\n"
+		       "Accept: */*\r\n"
+		       "\r\n",
+		HTTP_METHOD_GET, "/index.html", 1, "board.local", 0, 1},
+	{"wget", "GET /stats?fmt=json HTTP/1.1\r\n"
+		 "Host: 192.168.1.50\r\n"
+		 "User-Agent: Wget/1.21.4\r\n"
+		 "Accept: */*\r\n"
+		 "Accept-Encoding: identity\r\n"
+		 "Connection: Keep-Alive\r\n"
+		 "\r\n",
+		HTTP_METHOD_GET, "/stats?fmt=json", 1, "192.168.1.50", 0, 1},
+	{"python", "POST /health HTTP/1.1\r\n"
+		   "Host: 192.168.1.50\r\n"
+		   "User-Agent: python-requests/2.31.0\r\n"
+		   "Accept-Encoding: gzip, deflate\r\n"
+		   "Accept: */*\r\n"
+		   "Connection: keep-alive\r\n"
+		   "Content-Length: 17\r\n"
+		   "Content-Type: application/json\r\n"
+		   "\r\n",
+		HTTP_METHOD_POST, "/health", 1, "192.168.1.50", 17, 1},
+	{"ab 1.0", "GET / HTTP/1.0\r\n"
+		   "Host: 192.168.1.50\r\n"
+		   "User-Agent: ApacheBench/2.3\r\n"
+		   "Accept: */*\r\n"
+		   "\r\n",
+		HTTP_METHOD_GET, "/", 0, "192.168.1.50", 0, 0},
+	{"1.0 keep-alive", "GET /health HTTP/1.0\r\n"
+			   "Connection: Keep-Alive\r\n"
+			   "Host: 192.168.1.50\r\n"
+			   "\r\n",
+		HTTP_METHOD_GET, "/health", 0, "192.168.1.50", 0, 1},
+	{"close", "GET /favicon.ico HTTP/1.1\r\n"
+		  "host:board   \r\n"
+		  "connection: close\r\n"
+		  "\r\n",
+		HTTP_METHOD_GET, "/favicon.ico", 1, "board", 0, 0},
+	{"leading CRLF", "\r\n\r\nGET /health HTTP/1.1\r\n"
+			 "Host: board\r\n"
+			 "\r\n",
+		HTTP_METHOD_GET, "/health", 1, "board", 0, 1},
+	{"other method", "OPTIONS * HTTP/1.1\r\n"
+			 "Host: board\r\n"
+			 "\r\n",
+		HTTP_METHOD_OTHER, "*", 1, "board", 0, 1},
+};
+
+#define CORPUS_COUNT (sizeof(corpus) / sizeof(corpus[0]))
+
+// Heads the parser has to refuse, and why
+// sizeof, not strlen: one of them holds a NUL
+#define REJECT(name, text) {name, text, (uint16_t)(sizeof(text) - 1)}
+
+static const struct {
+	const char* name;
+	const char* text;
+	uint16_t len;
+} rejects[] = {
+	REJECT("duplicate Content-Length", "POST / HTTP/1.1\r\nHost: b\r\nContent-Length: 5\r\n"
+				     "Content-Length: 5\r\n\r\n"),
+	REJECT("Content-Length list", "POST / HTTP/1.1\r\nHost: b\r\nContent-Length: 5, 5\r\n\r\n"),
+	REJECT("Content-Length sign", "POST / HTTP/1.1\r\nHost: b\r\nContent-Length: +5\r\n\r\n"),
+	REJECT("Content-Length overflow", "POST / HTTP/1.1\r\nContent-Length: 4294967296\r\n\r\n"),
+	REJECT("Transfer-Encoding", "POST / HTTP/1.1\r\nHost: b\r\nTransfer-Encoding: chunked\r\n\r\n"),
+	REJECT("Transfer-Encoding and Content-Length", "POST / HTTP/1.1\r\nContent-Length: 3\r\n"
+						 "Transfer-Encoding: chunked\r\n\r\n"),
+	REJECT("obs-fold", "GET / HTTP/1.1\r\nHost: b\r\nX-Long: one\r\n two\r\n\r\n"),
+	REJECT("obs-fold tab", "GET / HTTP/1.1\r\nHost: b\r\nX-Long: one\r\n\ttwo\r\n\r\n"),
+	REJECT("space before colon", "GET / HTTP/1.1\r\nHost : b\r\n\r\n"),
+	REJECT("bare LF request line", "GET / HTTP/1.1\nHost: b\r\n\r\n"),
+	REJECT("bare LF header", "GET / HTTP/1.1\r\nHost: b\n\r\n"),
+	REJECT("bare LF blank line", "GET / HTTP/1.1\r\nHost: b\r\n\n"),
+	REJECT("bare LF leading", "\nGET / HTTP/1.1\r\nHost: b\r\n\r\n"),
+	REJECT("CR without LF", "GET / HTTP/1.1\rHost: b\r\n\r\n"),
+	REJECT("HTTP/2", "GET / HTTP/2.0\r\nHost: b\r\n\r\n"),
+	REJECT("lower case version", "GET / http/1.1\r\nHost: b\r\n\r\n"),
+	REJECT("no target", "GET  HTTP/1.1\r\nHost: b\r\n\r\n"),
+	REJECT("control in target", "GET /a\x01 HTTP/1.1\r\nHost: b\r\n\r\n"),
+	REJECT("NUL in value", "GET / HTTP/1.1\r\nHost: b\0c\r\n\r\n"),
+	REJECT("DEL in value", "GET / HTTP/1.1\r\nHost: b\x7F\r\n\r\n"),
+	REJECT("empty name", "GET / HTTP/1.1\r\n: b\r\n\r\n"),
+};
+
+#define REJECT_COUNT (sizeof(rejects) / sizeof(rejects[0]))
+
+// Feeds text[0 .. split) first, then all of it. Returns the final result.
+static http_parse_rc_t parse_split(http_req_t* req,
+	const uint8_t* buf,
+	uint16_t len,
+	uint16_t split) {
+	http_req_init(req);
+
+	http_parse_rc_t rc = http_parse(req, buf, split);
+	if (rc != HTTP_PARSE_MORE)
+		return rc;
+	return http_parse(req, buf, len);
+}
+
+// One byte more on every call, as a client that trickles the head would deliver it
+static http_parse_rc_t parse_bytewise(http_req_t* req, const uint8_t* buf, uint16_t len) {
+	http_parse_rc_t rc = HTTP_PARSE_MORE;
+
+	http_req_init(req);
+	for (uint16_t n = 1; n <= len && rc == HTTP_PARSE_MORE; n++)
+		rc = http_parse(req, buf, n);
+	return rc;
+}
+
+static int slice_is(const uint8_t* buf, http_slice_t s, const char* str) {
+	return s.len == strlen(str) && memcmp(buf + s.off, str, s.len) == 0;
+}
+
+static int same_result(const http_req_t* a, const http_req_t* b) {
+	return a->method == b->method && a->version_minor == b->version_minor &&
+	       a->target.off == b->target.off && a->target.len == b->target.len &&
+	       memcmp(a->hdrs, b->hdrs, sizeof(a->hdrs)) == 0 && a->hdr_seen == b->hdr_seen &&
+	       a->content_length == b->content_length && a->head_len == b->head_len &&
+	       a->body_left == b->body_left;
+}
+
+static void check_corpus(void) {
+	for (size_t i = 0; i < CORPUS_COUNT; i++) {
+		const capture_t* c = &corpus[i];
+		const uint8_t* buf = (const uint8_t*)c->text;
+		uint16_t len = (uint16_t)strlen(c->text);
+		http_req_t whole;
+		http_req_t part;
+
+		http_req_init(&whole);
+		if (http_parse(&whole, buf, len) != HTTP_PARSE_DONE) {
+			sim_fail(__FILE__, __LINE__, "%s: not parsed", c->name);
+			continue;
+		}
+
+		SIM_CHECK_EQ(whole.method, c->method);
+		SIM_CHECK(slice_is(buf, whole.target, c->target));
+		SIM_CHECK_EQ(whole.version_minor, c->version_minor);
+		SIM_CHECK(http_has(&whole, HTTP_HDR_HOST));
+		SIM_CHECK(slice_is(buf, whole.hdrs[HTTP_HDR_HOST], c->host));
+		SIM_CHECK_EQ(whole.content_length, c->content_length);
+		SIM_CHECK_EQ(whole.body_left, c->content_length);
+		SIM_CHECK_EQ(whole.head_len, len);
+		SIM_CHECK_EQ(http_keep_alive(&whole, buf), c->keep_alive);
+
+		// a second call after DONE changes nothing
+		SIM_CHECK_EQ(http_parse(&whole, buf, len), HTTP_PARSE_DONE);
+
+		// bytes after the head (body, next request) are not looked at
+		static uint8_t more[NET_REQ_BUF_SIZE];
+		memcpy(more, buf, len);
+		memcpy(more + len, "GARBAGE\n", 8);
+		http_req_init(&part);
+		SIM_CHECK_EQ(http_parse(&part, more, (uint16_t)(len + 8)), HTTP_PARSE_DONE);
+		SIM_CHECK(same_result(&part, &whole));
+
+		for (uint16_t split = 0; split < len; split++) {
+			if (parse_split(&part, buf, len, split) != HTTP_PARSE_DONE ||
+				!same_result(&part, &whole)) {
+				sim_fail(__FILE__, __LINE__, "%s: differs split at %u", c->name, split);
+				break;
+			}
+		}
+
+		SIM_CHECK_EQ(parse_bytewise(&part, buf, len), HTTP_PARSE_DONE);
+		SIM_CHECK(same_result(&part, &whole));
+	}
+}
+
+static void check_rejects(void) {
+	for (size_t i = 0; i < REJECT_COUNT; i++) {
+		const uint8_t* buf = (const uint8_t*)rejects[i].text;
+		uint16_t len = rejects[i].len;
+		http_req_t req;
+
+		for (uint16_t split = 0; split <= len; split++) {
+			if (parse_split(&req, buf, len, split) != HTTP_PARSE_ERROR) {
+				sim_fail(__FILE__, __LINE__, "%s: taken, split at %u", rejects[i].name,
+					split);
+				break;
+			}
+		}
+
+		SIM_CHECK_EQ(parse_bytewise(&req, buf, len), HTTP_PARSE_ERROR);
+	}
+}
+
+// net.c answers 431 when its buffer is full and the parser still wants more: a head that
+// fills the buffer exactly is fine, one byte more is not
+static void check_oversized(void) {
+	static uint8_t buf[NET_REQ_BUF_SIZE + 1];
+	static const char line[] = "GET / HTTP/1.1\r\nHost: b\r\nX-Pad: ";
+	http_req_t req;
+
+	memcpy(buf, line, sizeof(line) - 1);
+	memset(buf + sizeof(line) - 1, 'a', sizeof(buf) - (sizeof(line) - 1));
+
+	// exactly NET_REQ_BUF_SIZE with the blank line at the end
+	memcpy(buf + NET_REQ_BUF_SIZE - 4, "\r\n\r\n", 4);
+	http_req_init(&req);
+	SIM_CHECK_EQ(http_parse(&req, buf, NET_REQ_BUF_SIZE), HTTP_PARSE_DONE);
+	SIM_CHECK_EQ(req.head_len, NET_REQ_BUF_SIZE);
+
+	// the last LF does not fit: the buffer is full and the head incomplete
+	memset(buf + sizeof(line) - 1, 'a', sizeof(buf) - (sizeof(line) - 1));
+	memcpy(buf + NET_REQ_BUF_SIZE - 3, "\r\n\r\n", 4);
+	http_req_init(&req);
+	SIM_CHECK_EQ(http_parse(&req, buf, NET_REQ_BUF_SIZE), HTTP_PARSE_MORE);
+	SIM_CHECK_EQ(http_parse(&req, buf, NET_REQ_BUF_SIZE + 1), HTTP_PARSE_DONE);
+
+	// many short headers, none of them with a blank line after: still incomplete at the limit
+	uint16_t n = 0;
+	n = (uint16_t)(n + sprintf((char*)buf, "GET / HTTP/1.1\r\n"));
+	while (n + 8 <= NET_REQ_BUF_SIZE)
+		n = (uint16_t)(n + sprintf((char*)buf + n, "X-A: b\r\n"));
+	http_req_init(&req);
+	SIM_CHECK_EQ(http_parse(&req, buf, n), HTTP_PARSE_MORE);
+}
+
+// Accept-Encoding as route_static() reads it: a weight of 0 refuses gzip (RFC 9110 12.5.3)
+static const struct {
+	const char* value;
+	int gzip;
+} encodings[] = {
+	{"gzip", 1},
+	{"gzip, deflate, br", 1},
+	{"deflate, GZIP", 1},
+	{"gzip;q=0", 0},
+	{"gzip; q=0.000", 0},
+	{"gzip ;Q=0.", 0},
+	{"deflate, gzip;q=0, br", 0},
+	{"gzip;q=0.001", 1},
+	{"gzip;q=0.5, identity;q=0", 1},
+	{"gzip;level=1;q=1", 1},
+	{"identity;q=0, gzip", 1},
+	{"x-gzip", 0},
+	{"br;q=0, gzip;q=0", 0},
+};
+
+#define ENCODING_COUNT (sizeof(encodings) / sizeof(encodings[0]))
+
+static void check_accept_encoding(void) {
+	static uint8_t buf[256];
+	http_req_t req;
+
+	for (size_t i = 0; i < ENCODING_COUNT; i++) {
+		uint16_t len = (uint16_t)snprintf((char*)buf, sizeof(buf),
+			"GET / HTTP/1.1\r\nHost: b\r\nAccept-Encoding: %s\r\n\r\n", encodings[i].value);
+
+		http_req_init(&req);
+		SIM_CHECK_EQ(http_parse(&req, buf, len), HTTP_PARSE_DONE);
+		if (http_hdr_has_token(&req, buf, HTTP_HDR_ACCEPT_ENCODING, "gzip", 4) !=
+			encodings[i].gzip)
+			sim_fail(__FILE__, __LINE__, "Accept-Encoding: %s", encodings[i].value);
+	}
+}
+
+static uint64_t host_ns(void) {
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+#define BENCH_ROUNDS 20000u
+
+static void bench(void) {
+	size_t bytes = 0;
+	volatile uint16_t sink = 0;
+	http_req_t req;
+
+	for (size_t i = 0; i < CORPUS_COUNT; i++)
+		bytes += strlen(corpus[i].text);
+
+	printf("http_parse over the corpus (%zu heads, %zu bytes), host:\n", CORPUS_COUNT, bytes);
+
+	uint64_t t0 = host_ns();
+	for (uint32_t r = 0; r < BENCH_ROUNDS; r++) {
+		for (size_t i = 0; i < CORPUS_COUNT; i++) {
+			const uint8_t* buf = (const uint8_t*)corpus[i].text;
+			http_req_init(&req);
+			(void)http_parse(&req, buf, (uint16_t)strlen(corpus[i].text));
+			sink = (uint16_t)(sink + req.head_len);
+		}
+	}
+	uint64_t whole_ns = host_ns() - t0;
+
+	// one call per TCP segment is typical; one call per byte is the worst a client can cause
+	t0 = host_ns();
+	for (uint32_t r = 0; r < BENCH_ROUNDS / 10; r++) {
+		for (size_t i = 0; i < CORPUS_COUNT; i++) {
+			const uint8_t* buf = (const uint8_t*)corpus[i].text;
+			(void)parse_bytewise(&req, buf, (uint16_t)strlen(corpus[i].text));
+			sink = (uint16_t)(sink + req.head_len);
+		}
+	}
+	uint64_t byte_ns = host_ns() - t0;
+	(void)sink;
+
+	printf("  whole head      %7.1f MB/s  %6.0f ns per head\n",
+		(double)bytes * BENCH_ROUNDS * 1e3 / (double)whole_ns,
+		(double)whole_ns / ((double)BENCH_ROUNDS * CORPUS_COUNT));
+	printf("  byte by byte    %7.1f MB/s  %6.0f ns per head\n",
+		(double)bytes * (BENCH_ROUNDS / 10) * 1e3 / (double)byte_ns,
+		(double)byte_ns / ((double)(BENCH_ROUNDS / 10) * CORPUS_COUNT));
+}
+
+int main(void) {
+	check_corpus();
+	check_rejects();
+	check_oversized();
+	check_accept_encoding();
+
+	if (sim_failures() != 0) {
+		printf("test_http: %d failure(s)\n", sim_failures());
+		return 1;
+	}
+
+	bench();
+	printf("test_http: ok\n");
+	return 0;
+}
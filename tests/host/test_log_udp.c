@@ -0,0 +1,108 @@
+// The UDP log sink (LOGGER_UDP, built in here next to the UART one) on the whole stack: boot as
+// main.c does, log a few batches worth of lines, then read back what the W5500 model sent.
+//  - more than one datagram goes out, all to NET_LOG_DEST_PORT, none over the batch size
+//  - sequence numbers count up from 0 without a gap, so no batch was dropped
+//  - the payloads put together are exactly the UART stream: the same records, whole, all of them
+#include <stdio.h>
+#include <string.h>
+
+#include "board.h"
+#include "drivers/spi.h"
+#include "modules/logger.h"
+#include "modules/net.h"
+#include "sim.h"
+#include "task.h"
+
+#define BOOT_NS 500000000ull
+#define LINES 168u
+#define BURST 56u	 // lines at once: more than one datagram, still inside the log ring
+#define BURST_MS 20u // the UART (1 Mbaud) drains a burst in about 11 ms
+
+static void startup_task(void* arg) {
+	(void)arg;
+
+	logger_init();
+	net_init();
+
+	vTaskDelete(NULL);
+}
+
+static uint32_t count_lines(const uint8_t* buf, size_t len) {
+	static const char line[] = "udp test line";
+	uint32_t n = 0;
+
+	for (size_t i = 0; i + sizeof(line) - 1 <= len; i++) {
+		if (memcmp(buf + i, line, sizeof(line) - 1) == 0)
+			n++;
+	}
+	return n;
+}
+
+static void client_task(void* arg) {
+	(void)arg;
+	static uint8_t stream[LINES * 64u + 4096u];
+	size_t stream_len = 0;
+
+	sim_wait_ns(BOOT_NS);
+
+	for (uint32_t i = 0; i < LINES; i++) {
+		LOG_VALUE(LOG_LEVEL_INFO, LOG_MOD_APP, "udp test line", &i);
+		if (i % BURST == BURST - 1)
+			vTaskDelay(pdMS_TO_TICKS(BURST_MS));
+	}
+	vTaskDelay(pdMS_TO_TICKS(50)); // the last batch goes out once the logger is idle
+
+	uint32_t n = sim_udp_count();
+	SIM_CHECK(n >= 2);
+
+	for (uint32_t i = 0; i < n; i++) {
+		size_t len;
+		uint16_t dport;
+		const uint8_t* d = sim_udp_get(i, &len, &dport);
+
+		SIM_CHECK_EQ(dport, NET_LOG_DEST_PORT);
+		SIM_CHECK(len > 2 && len <= 2u + NET_LOG_BATCH);
+		if (len < 2)
+			continue;
+		SIM_CHECK_EQ(d[0] | (d[1] << 8), i);
+
+		if (stream_len + len - 2 <= sizeof(stream)) {
+			memcpy(stream + stream_len, d + 2, len - 2);
+			stream_len += len - 2;
+		}
+	}
+
+	SIM_CHECK_EQ(count_lines(stream, stream_len), LINES);
+
+	size_t uart_len;
+	const uint8_t* uart = sim_uart_output(&uart_len);
+	SIM_CHECK_EQ(stream_len, uart_len);
+	SIM_CHECK(stream_len == uart_len && memcmp(stream, uart, uart_len) == 0);
+
+	printf("UDP log sink: %u lines in %u datagrams, %u bytes, same as the UART\n",
+		LINES,
+		n,
+		(unsigned)stream_len);
+
+	SIM_CHECK_EQ(sim_w5500_errors(), 0);
+	sim_finish();
+}
+
+int main(void) {
+	sim_init();
+	sim_w5500_init();
+
+	static const spi_pins_t spi_pins = {.sck = SCK_PIN, .mosi = MOSI_PIN, .miso = MISO_PIN};
+	spim_init(SPI_BUS_3, &spi_pins);
+
+	xTaskCreate(startup_task, "startup", 1024, NULL, 2, NULL);
+	xTaskCreate(client_task, "client", 1024, NULL, 1, NULL);
+	vTaskStartScheduler();
+
+	if (sim_failures() != 0) {
+		printf("test_log_udp: %d failure(s)\n", sim_failures());
+		return 1;
+	}
+	printf("test_log_udp: ok\n");
+	return 0;
+}
@@ -0,0 +1,196 @@
+// The log ring under real concurrency: producer pthreads log at once through logger.c (built in
+// here, so the test can drain it with logger_try_pop() itself) while one thread consumes. The
+// exclusive access stand-ins in nrf52840.h are compare-and-swap; every DMB may yield, to widen
+// the windows between claim, write and stamp.
+//  - rounds that fit the ring: every record comes out exactly once, each producer's in order
+//  - producers lapping the consumer: what comes out is whole and in order, the rest is dropped
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "../../src/modules/logger.c"
+
+#include "sim.h"
+
+#define PRODUCERS 8
+#define ROUNDS 20000u
+#define ROUND_RECS 2u // per producer and round, small enough that a round never laps
+#define FLOOD_RECS 50000u
+
+_Static_assert(PRODUCERS * ROUND_RECS * 6u <= SLOT_COUNT, "a round must fit the ring");
+
+// Payload of record k of producer p: p, k (LE32), length, a pattern, XOR of all before it.
+// 8 to 60 bytes, so records take 2 to 6 slots.
+static uint8_t rec_len_of(uint32_t p, uint32_t k) {
+	return (uint8_t)(8u + (k * 7u + p * 13u) % 53u);
+}
+
+static void make_payload(uint32_t p, uint32_t k, uint8_t* out, uint8_t len) {
+	uint8_t x = 0;
+
+	out[0] = (uint8_t)p;
+	out[1] = (uint8_t)k;
+	out[2] = (uint8_t)(k >> 8);
+	out[3] = (uint8_t)(k >> 16);
+	out[4] = (uint8_t)(k >> 24);
+	out[5] = len;
+	for (uint8_t i = 6; i < len - 1; i++)
+		out[i] = (uint8_t)(k * 31u + p + i);
+	for (uint8_t i = 0; i < len - 1; i++)
+		x ^= out[i];
+	out[len - 1] = x;
+}
+
+static void produce(uint32_t p, uint32_t k) {
+	uint8_t data[64];
+	uint8_t len = rec_len_of(p, k);
+
+	make_payload(p, k, data, len);
+	logger_log_hex_len("st", 2, data, len);
+}
+
+// What the consumer has seen of each producer
+static uint32_t next_k[PRODUCERS];
+static uint32_t popped;
+static uint32_t bad;
+
+// Checks one record from logger_try_pop(). Returns the producer, or -1.
+static int check_rec(const uint8_t* rec) {
+	uint8_t want[64];
+
+	if (rec[0] != LOG_HEX || rec[2] != 2 || rec[4] != 's' || rec[5] != 't')
+		return -1;
+
+	const uint8_t* d = rec + REC_HDR + 2;
+	uint8_t len = (uint8_t)(rec[1] - 2);
+	uint32_t p = d[0];
+	uint32_t k = (uint32_t)d[1] | ((uint32_t)d[2] << 8) | ((uint32_t)d[3] << 16) |
+		     ((uint32_t)d[4] << 24);
+
+	if (p >= PRODUCERS || len < 8 || len != rec_len_of(p, k))
+		return -1;
+	make_payload(p, k, want, len);
+	if (memcmp(d, want, len) != 0)
+		return -1;
+
+	// a producer's records are reserved in program order, so they come out in it
+	if (k < next_k[p])
+		return -1;
+	next_k[p] = k + 1;
+	return (int)p;
+}
+
+static uint32_t drain(void) {
+	uint8_t rec[REC_MAX];
+	uint32_t n = 0;
+
+	while (logger_try_pop(rec)) {
+		if (check_rec(rec) < 0) {
+			if (bad++ < 5)
+				sim_fail(__FILE__, __LINE__, "bad record, %u bytes", rec[1]);
+		}
+		n++;
+	}
+	return n;
+}
+
+static void yield_sometimes(void) {
+	static __thread uint32_t rnd = 0x9E3779B9u;
+
+	rnd ^= rnd << 13;
+	rnd ^= rnd >> 17;
+	rnd ^= rnd << 5;
+	if ((rnd & 7u) == 0)
+		sched_yield();
+}
+
+static pthread_barrier_t round_start;
+static pthread_barrier_t round_end;
+static volatile int flooding;
+
+static void* producer(void* arg) {
+	uint32_t p = (uint32_t)(uintptr_t)arg;
+	uint32_t k = 0;
+
+	for (uint32_t r = 0; r < ROUNDS; r++) {
+		pthread_barrier_wait(&round_start);
+		for (uint32_t i = 0; i < ROUND_RECS; i++)
+			produce(p, k++);
+		pthread_barrier_wait(&round_end);
+	}
+
+	pthread_barrier_wait(&round_start);
+	for (uint32_t i = 0; i < FLOOD_RECS; i++)
+		produce(p, k++);
+	return NULL;
+}
+
+static void* consumer(void* arg) {
+	(void)arg;
+
+	while (flooding) {
+		popped += drain();
+		sched_yield();
+	}
+	popped += drain();
+	return NULL;
+}
+
+int main(void) {
+	logger_init();
+	logger_task_handle = NULL; // drained here, nobody to wake
+	sim_preempt_hook = yield_sometimes;
+
+	pthread_t threads[PRODUCERS];
+	pthread_barrier_init(&round_start, NULL, PRODUCERS + 1);
+	pthread_barrier_init(&round_end, NULL, PRODUCERS + 1);
+	for (uintptr_t p = 0; p < PRODUCERS; p++)
+		pthread_create(&threads[p], NULL, producer, (void*)p);
+
+	// rounds that fit: nothing may be lost
+	for (uint32_t r = 0; r < ROUNDS; r++) {
+		pthread_barrier_wait(&round_start);
+		pthread_barrier_wait(&round_end);
+
+		uint32_t n = drain();
+		if (n != PRODUCERS * ROUND_RECS || dropped != 0) {
+			sim_fail(__FILE__, __LINE__, "round %u: %u records, %u slots dropped", r, n,
+				dropped);
+			break;
+		}
+	}
+	for (uint32_t p = 0; p < PRODUCERS; p++)
+		SIM_CHECK_EQ(next_k[p], ROUNDS * ROUND_RECS);
+
+	// flood: the ring laps, the consumer runs alongside
+	pthread_t cons;
+	flooding = 1;
+	pthread_create(&cons, NULL, consumer, NULL);
+	pthread_barrier_wait(&round_start);
+	for (uint32_t p = 0; p < PRODUCERS; p++)
+		pthread_join(threads[p], NULL);
+	flooding = 0;
+	pthread_join(cons, NULL);
+
+	SIM_CHECK_EQ(bad, 0);
+	SIM_CHECK(popped > 0 && popped < PRODUCERS * FLOOD_RECS);
+	SIM_CHECK(dropped > 0);
+	SIM_CHECK_EQ(ring_tail, ring_head); // drained to the end, nothing left half written
+
+	printf("log ring, %u slots: %u producers x %u rounds exact; flood of %u records: %u out, "
+	       "%u slots dropped\n",
+		(unsigned)SLOT_COUNT,
+		PRODUCERS,
+		ROUNDS,
+		PRODUCERS * FLOOD_RECS,
+		popped,
+		dropped);
+
+	if (sim_failures() != 0) {
+		printf("test_logger: %d failure(s)\n", sim_failures());
+		return 1;
+	}
+	printf("test_logger: ok\n");
+	return 0;
+}
@@ -0,0 +1,263 @@
+// The whole stack on the host: spi.c, w5500_port.c, net.c, http.c and the logger, booted as
+// main.c does, then scripted clients against the simulated W5500. Prints the SPI traffic each
+// kind of request costs.
+#include <stdio.h>
+#include <string.h>
+
+#include "board.h"
+#include "drivers/spi.h"
+#include "modules/logger.h"
+#include "modules/net.h"
+#include "sim.h"
+#include "task.h"
+
+#define BOOT_NS 500000000ull // net_init() waits 160 ms for the chip, the first sweep opens
+
+static void startup_task(void* arg) {
+	(void)arg;
+
+	logger_init();
+	net_init();
+
+	vTaskDelete(NULL);
+}
+
+static int has_prefix(const uint8_t* buf, size_t len, const char* prefix) {
+	size_t n = strlen(prefix);
+	return len >= n && memcmp(buf, prefix, n) == 0;
+}
+
+// One request on its own connection, the client closes once the server has. Returns the peer.
+static int request(const char* req, uint64_t limit_ns) {
+	int p = sim_tcp_connect(HTTP_PORT);
+	uint64_t start = sim_now();
+
+	sim_tcp_send(p, req, strlen(req));
+	while (sim_tcp_state(p) != SIM_TCP_CLOSED && sim_now() - start < limit_ns)
+		vTaskDelay(1);
+
+	return p;
+}
+
+static size_t count(const uint8_t* buf, size_t len, const char* needle) {
+	size_t n = strlen(needle);
+	size_t hits = 0;
+
+	for (size_t i = 0; i + n <= len; i++) {
+		if (memcmp(buf + i, needle, n) == 0)
+			hits++;
+	}
+	return hits;
+}
+
+// First occurrence of needle in buf, or NULL
+static const uint8_t* find(const uint8_t* buf, size_t len, const char* needle) {
+	size_t n = strlen(needle);
+
+	for (size_t i = 0; i + n <= len; i++) {
+		if (memcmp(buf + i, needle, n) == 0)
+			return buf + i;
+	}
+	return NULL;
+}
+
+// Bytes after the head, 0 while it is incomplete
+static size_t head_len(const uint8_t* buf, size_t len) {
+	const uint8_t* end = find(buf, len, "\r\n\r\n");
+	return end ? (size_t)(end - buf) + 4 : 0;
+}
+
+// A chunked body, exactly up to and including its last chunk ("0\r\n\r\n", no trailers):
+// the data goes to out. Returns its length, or -1 if the framing is off anywhere.
+static long dechunk(const uint8_t* p, size_t len, uint8_t* out, size_t cap) {
+	const uint8_t* end = p + len;
+	size_t n = 0;
+
+	for (;;) {
+		size_t size = 0;
+		const uint8_t* digits = p;
+		while (p < end && ((*p >= '0' && *p <= '9') || (*p >= 'a' && *p <= 'f') ||
+					  (*p >= 'A' && *p <= 'F'))) {
+			size = size * 16 + (size_t)((*p <= '9') ? *p - '0' : (*p | 0x20) - 'a' + 10);
+			p++;
+		}
+		if (p == digits || end - p < 2 || p[0] != '\r' || p[1] != '\n')
+			return -1;
+		p += 2;
+
+		if (size == 0)
+			return (end - p == 2 && p[0] == '\r' && p[1] == '\n') ? (long)n : -1;
+
+		if ((size_t)(end - p) < size + 2 || n + size > cap || p[size] != '\r' ||
+			p[size + 1] != '\n')
+			return -1;
+		memcpy(out + n, p, size);
+		n += size;
+		p += size + 2;
+	}
+}
+
+static uint32_t frames_mark;
+
+static void mark(void) {
+	sim_spim_stats_reset(3);
+	frames_mark = sim_w5500_frames();
+}
+
+static void report(const char* what, uint32_t requests) {
+	const sim_spim_stats_t* st = sim_spim_stats(3);
+
+	printf("  %-28s %6.0f SPI bytes %5.1f transfers %5.1f frames per request\n",
+		what,
+		(double)st->bytes / requests,
+		(double)st->starts / requests,
+		(double)(sim_w5500_frames() - frames_mark) / requests);
+}
+
+static void client_task(void* arg) {
+	(void)arg;
+	size_t len;
+	const uint8_t* rx;
+
+	sim_wait_ns(BOOT_NS);
+	SIM_CHECK_EQ(sim_w5500_errors(), 0);
+
+	// Connection: close, so every request is one whole connection
+	mark();
+	int p = request("GET /health HTTP/1.1\r\nHost: board\r\nConnection: close\r\n\r\n",
+		100000000ull);
+
+	SIM_CHECK_EQ(sim_tcp_state(p), SIM_TCP_CLOSED);
+	rx = sim_tcp_received(p, &len);
+	SIM_CHECK(has_prefix(rx, len, "HTTP/1.1 200 OK\r\n"));
+	SIM_CHECK(len > 15 && memcmp(rx + len - 15, "{\"status\":\"ok\"}", 15) == 0);
+	SIM_CHECK_EQ(count(rx, len, "Connection: close\r\n"), 1);
+
+	printf("SPI cost, one connection each (SPIM3, W5500 model):\n");
+	report("GET /health", 1);
+
+	// a static asset, and a miss
+	mark();
+	p = request("GET / HTTP/1.1\r\nHost: board\r\nConnection: close\r\n\r\n", 100000000ull);
+	rx = sim_tcp_received(p, &len);
+	SIM_CHECK(has_prefix(rx, len, "HTTP/1.1 200 OK\r\n"));
+	report("GET / (index.html)", 1);
+
+	mark();
+	p = request("GET /nope HTTP/1.1\r\nHost: board\r\nConnection: close\r\n\r\n", 100000000ull);
+	rx = sim_tcp_received(p, &len);
+	SIM_CHECK(has_prefix(rx, len, "HTTP/1.1 404 Not Found\r\n"));
+
+	// a head that never ends within NET_REQ_BUF_SIZE: 431, and the server closes
+	static char big[NET_REQ_BUF_SIZE + 64];
+	size_t n = (size_t)sprintf(big, "GET / HTTP/1.1\r\nHost: board\r\n");
+	while (n + 12 < sizeof(big) - 1)
+		n += (size_t)sprintf(big + n, "X-Pad: abc\r\n");
+	p = request(big, 100000000ull);
+	SIM_CHECK_EQ(sim_tcp_state(p), SIM_TCP_CLOSED);
+	rx = sim_tcp_received(p, &len);
+	SIM_CHECK(has_prefix(rx, len, "HTTP/1.1 431 Request Header Fields Too Large\r\n"));
+
+	// keep-alive: three requests back to back on one connection, then the client closes
+	mark();
+	p = sim_tcp_connect(HTTP_PORT);
+	static const char ka[] = "GET /health HTTP/1.1\r\nHost: board\r\n\r\n";
+	for (size_t i = 1; i <= 3; i++) {
+		sim_tcp_send(p, ka, sizeof(ka) - 1);
+		for (int t = 0; t < 100; t++) {
+			rx = sim_tcp_received(p, &len);
+			if (count(rx, len, "{\"status\":\"ok\"}") == i)
+				break;
+			vTaskDelay(1);
+		}
+	}
+	report("GET /health, keep-alive", 3);
+	rx = sim_tcp_received(p, &len);
+	SIM_CHECK_EQ(sim_tcp_state(p), SIM_TCP_OPEN);
+	SIM_CHECK_EQ(count(rx, len, "Connection: keep-alive\r\n"), 3);
+	sim_tcp_close(p);
+	vTaskDelay(pdMS_TO_TICKS(10));
+	SIM_CHECK_EQ(sim_tcp_state(p), SIM_TCP_CLOSED);
+
+	// pipelined: three requests in one segment, answered in order, the last one closes
+	p = request("GET /health HTTP/1.1\r\nHost: board\r\n\r\n"
+		    "GET /nope HTTP/1.1\r\nHost: board\r\n\r\n"
+		    "GET /health HTTP/1.1\r\nHost: board\r\nConnection: close\r\n\r\n",
+		100000000ull);
+	SIM_CHECK_EQ(sim_tcp_state(p), SIM_TCP_CLOSED);
+	rx = sim_tcp_received(p, &len);
+	SIM_CHECK_EQ(count(rx, len, "HTTP/1.1 "), 3);
+	const uint8_t* r1 = find(rx, len, "HTTP/1.1 200 OK\r\n");
+	const uint8_t* r2 = find(rx, len, "HTTP/1.1 404 Not Found\r\n");
+	const uint8_t* r3 = r2 ? find(r2, len - (size_t)(r2 - rx), "HTTP/1.1 200 OK\r\n") : NULL;
+	SIM_CHECK(r1 == rx && r2 != NULL && r3 != NULL);
+	SIM_CHECK_EQ(count(rx, len, "{\"status\":\"ok\"}"), 2);
+	if (r3 != NULL) {
+		size_t last = len - (size_t)(r3 - rx);
+		SIM_CHECK(find(r3, last, "Connection: close\r\n") != NULL);
+		SIM_CHECK(last > 15 && memcmp(rx + len - 15, "{\"status\":\"ok\"}", 15) == 0);
+	}
+
+	// conditional GET: the ETag of the first answer gets a 304, head only
+	p = request("GET /style.css HTTP/1.1\r\nHost: board\r\nConnection: close\r\n\r\n",
+		100000000ull);
+	rx = sim_tcp_received(p, &len);
+	SIM_CHECK(has_prefix(rx, len, "HTTP/1.1 200 OK\r\n"));
+	const uint8_t* tag = find(rx, head_len(rx, len), "ETag: ");
+	const uint8_t* tag_end = tag ? find(tag, len - (size_t)(tag - rx), "\r\n") : NULL;
+	SIM_CHECK(tag != NULL && tag_end != NULL && tag_end - tag < 64);
+	if (tag != NULL && tag_end != NULL && tag_end - tag < 64) {
+		char etag[64]; // "ETag: <tag>"
+		static char cond[256];
+
+		memcpy(etag, tag, (size_t)(tag_end - tag));
+		etag[tag_end - tag] = '\0';
+		sprintf(cond,
+			"GET /style.css HTTP/1.1\r\nHost: board\r\nIf-None-Match: %s\r\n"
+			"Connection: close\r\n\r\n",
+			etag + 6);
+
+		p = request(cond, 100000000ull);
+		SIM_CHECK_EQ(sim_tcp_state(p), SIM_TCP_CLOSED);
+		rx = sim_tcp_received(p, &len);
+		SIM_CHECK(has_prefix(rx, len, "HTTP/1.1 304 Not Modified\r\n"));
+		SIM_CHECK(find(rx, len, etag) != NULL);
+		SIM_CHECK_EQ(head_len(rx, len), len); // no body after the head
+	}
+
+	// a generated body of unknown length: chunked, ended by the last chunk
+	p = request("GET /stats HTTP/1.1\r\nHost: board\r\nConnection: close\r\n\r\n",
+		100000000ull);
+	SIM_CHECK_EQ(sim_tcp_state(p), SIM_TCP_CLOSED);
+	rx = sim_tcp_received(p, &len);
+	size_t head = head_len(rx, len);
+	SIM_CHECK(has_prefix(rx, len, "HTTP/1.1 200 OK\r\n") && head != 0);
+	SIM_CHECK(find(rx, head, "Transfer-Encoding: chunked\r\n") != NULL);
+	SIM_CHECK(find(rx, head, "Content-Length:") == NULL);
+	static uint8_t body[512];
+	long body_len = dechunk(rx + head, len - head, body, sizeof(body));
+	SIM_CHECK(body_len > 16 && memcmp(body, "{\"tx_stalls\":[", 14) == 0 &&
+		  memcmp(body + body_len - 2, "]}", 2) == 0);
+
+	SIM_CHECK_EQ(sim_w5500_errors(), 0);
+	sim_finish();
+}
+
+int main(void) {
+	sim_init();
+	sim_w5500_init();
+
+	static const spi_pins_t spi_pins = {.sck = SCK_PIN, .mosi = MOSI_PIN, .miso = MISO_PIN};
+	spim_init(SPI_BUS_3, &spi_pins);
+
+	xTaskCreate(startup_task, "startup", 1024, NULL, 2, NULL);
+	xTaskCreate(client_task, "client", 1024, NULL, 1, NULL);
+	vTaskStartScheduler();
+
+	if (sim_failures() != 0) {
+		printf("test_net: %d failure(s)\n", sim_failures());
+		return 1;
+	}
+	printf("test_net: ok\n");
+	return 0;
+}
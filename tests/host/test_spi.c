@@ -0,0 +1,151 @@
+// spi.c against the simulated SPIM0: a blocking transfer sleeps on the END interrupt and wakes
+// once, a transfer whose END never comes fails after its timeout, and the bus works afterwards.
+#include <stdio.h>
+#include <string.h>
+
+#include "board.h"
+#include "drivers/spi.h"
+#include "sim.h"
+#include "task.h"
+
+#define DEV_CS_PIN 11
+
+// Answers every byte with mosi ^ 0x5A and keeps what it got
+static uint8_t dev_seen[256];
+static size_t dev_seen_len;
+
+static void dev_select(uint8_t selected) {
+	if (selected)
+		dev_seen_len = 0;
+}
+
+static uint8_t dev_xfer(uint8_t mosi) {
+	if (dev_seen_len < sizeof(dev_seen))
+		dev_seen[dev_seen_len++] = mosi;
+	return (uint8_t)(mosi ^ 0x5A);
+}
+
+static const sim_spi_dev_t sim_dev = {.cs_pin = DEV_CS_PIN, .select = dev_select, .xfer = dev_xfer};
+
+static const spi_device_t dev = {.bus = SPI_BUS_0,
+	.cs_pin = DEV_CS_PIN,
+	.mode = SPI_MODE_0,
+	.frequency = SPI_FREQ_8M,
+	.order = SPI_MSB_FIRST,
+	.dummy_byte = 0xFF};
+
+static TaskHandle_t test_task;
+
+static void check_completion(void) {
+	uint8_t tx[64];
+	uint8_t rx[64];
+
+	for (size_t i = 0; i < sizeof(tx); i++)
+		tx[i] = (uint8_t)(i * 7 + 1);
+
+	SIM_CHECK_EQ(spi_begin(&dev), 0);
+	SIM_CHECK_EQ(sim_p0.OUT & (1u << DEV_CS_PIN), 0);
+
+	// full duplex: one START, one wakeup, the task sleeps for the whole wire time
+	uint32_t runs = sim_task_runs(test_task);
+	uint64_t t0 = sim_now();
+	SIM_CHECK_EQ(spi_txrx(&dev, tx, rx, sizeof(tx)), 0);
+	uint64_t took = sim_now() - t0;
+
+	SIM_CHECK_EQ(sim_task_runs(test_task) - runs, 1);
+	SIM_CHECK(took >= sizeof(tx) * 1000u && took < sizeof(tx) * 1000u + 2000u); // 8 MHz
+	SIM_CHECK_EQ(dev_seen_len, sizeof(tx));
+	SIM_CHECK(memcmp(dev_seen, tx, sizeof(tx)) == 0);
+	for (size_t i = 0; i < sizeof(rx); i++)
+		SIM_CHECK_EQ(rx[i], tx[i] ^ 0x5A);
+
+	// read only: the dummy byte is clocked out by ORC, nothing is read from memory for it
+	const sim_spim_stats_t* st = sim_spim_stats(0);
+	sim_spim_stats_reset(0);
+	memset(rx, 0, sizeof(rx));
+	SIM_CHECK_EQ(spi_rx(&dev, rx, 8), 0);
+	SIM_CHECK_EQ(st->tx_dma, 0);
+	SIM_CHECK_EQ(st->rx_dma, 8);
+	SIM_CHECK_EQ(dev_seen[sizeof(tx)], 0xFF);
+	SIM_CHECK_EQ(rx[0], 0xFF ^ 0x5A);
+
+	// write only: MISO is dropped, RXD.MAXCNT = 0
+	sim_spim_stats_reset(0);
+	SIM_CHECK_EQ(spi_tx(&dev, tx, 3), 0);
+	SIM_CHECK_EQ(st->tx_dma, 3);
+	SIM_CHECK_EQ(st->rx_dma, 0);
+
+	SIM_CHECK_EQ(spi_end(&dev), 0);
+	SIM_CHECK(sim_p0.OUT & (1u << DEV_CS_PIN));
+}
+
+static void check_timeout(void) {
+	uint8_t tx[16] = {0};
+
+	// blocking: the END that never comes costs SPI_TIMEOUT_TICKS (+1 ms wire budget), then -1
+	SIM_CHECK_EQ(spi_begin(&dev), 0);
+	sim_spim_stats_reset(0);
+	sim_spim_hang(0, 1);
+
+	uint64_t t0 = sim_now();
+	SIM_CHECK_EQ(spi_tx(&dev, tx, sizeof(tx)), -1);
+	uint64_t took = sim_now() - t0;
+
+	SIM_CHECK(took >= (SPI_TIMEOUT_TICKS + 1) * SIM_NS_PER_TICK);
+	SIM_CHECK(took <= (SPI_TIMEOUT_TICKS + 3) * SIM_NS_PER_TICK);
+	SIM_CHECK_EQ(sim_spim_stats(0)->stops, 1);
+
+	// the session survives: the next transfer goes through
+	SIM_CHECK_EQ(spi_tx(&dev, tx, sizeof(tx)), 0);
+	SIM_CHECK_EQ(spi_end(&dev), 0);
+
+	// asynchronous: a wedged descriptor is taken back by spi_cancel(), and its notification
+	// never arrives afterwards
+	static spi_xfer_t x;
+	static spi_seg_t seg;
+	static uint8_t buf[8];
+
+	seg = (spi_seg_t){.tx = NULL, .rx = buf, .len = sizeof(buf)};
+	x = (spi_xfer_t){.dev = &dev, .segs = &seg, .seg_count = 1, .notify = test_task};
+
+	sim_spim_hang(0, 1);
+	SIM_CHECK_EQ(spi_submit(&x), 0);
+	SIM_CHECK_EQ(ulTaskNotifyTakeIndexed(SPI_NOTIFY_INDEX, pdTRUE, SPI_TIMEOUT_TICKS), 0);
+	SIM_CHECK_EQ(spi_cancel(&x), -1);
+	SIM_CHECK(sim_p0.OUT & (1u << DEV_CS_PIN));
+	SIM_CHECK_EQ(ulTaskNotifyTakeIndexed(SPI_NOTIFY_INDEX, pdTRUE, pdMS_TO_TICKS(10)), 0);
+
+	// and the engine takes the next one
+	x.notify = test_task;
+	SIM_CHECK_EQ(spi_submit(&x), 0);
+	SIM_CHECK_EQ(ulTaskNotifyTakeIndexed(SPI_NOTIFY_INDEX, pdTRUE, SPI_TIMEOUT_TICKS), 1);
+	SIM_CHECK_EQ(x.status, 0);
+	SIM_CHECK_EQ(buf[0], 0xFF ^ 0x5A);
+}
+
+static void run(void* arg) {
+	(void)arg;
+
+	check_completion();
+	check_timeout();
+	sim_finish();
+}
+
+int main(void) {
+	sim_init();
+	sim_spi_attach(0, &sim_dev);
+
+	static const spi_pins_t pins = {.sck = SCK_PIN, .mosi = MOSI_PIN, .miso = MISO_PIN};
+	spim_init(SPI_BUS_0, &pins);
+	spi_device_init(&dev);
+
+	xTaskCreate(run, "test", 1024, NULL, 2, &test_task);
+	vTaskStartScheduler();
+
+	if (sim_failures() != 0) {
+		printf("test_spi: %d failure(s)\n", sim_failures());
+		return 1;
+	}
+	printf("test_spi: ok\n");
+	return 0;
+}
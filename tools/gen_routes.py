@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+"""Generate the HTTP route lookup from a route table.
+
+usage: gen_routes.py <routes.tbl> <out.c>
+
+Exact paths go into a perfect hash: FNV-1a over the path, with a seed searched here so that
+every path lands in its own slot of a power-of-two table. Lookup cost is one hash of the path
+plus one compare, whatever the number of routes. Prefix routes ('*' suffix) are kept in a
+short list, longest prefix first, and only tried when no exact path matches.
+"""
+
+import sys
+
+from phash import C_HASH, c_slots, c_str, perfect_hash
+
+METHODS = ("GET", "POST")  # http_method_t values with a handler slot
+
+
+def parse(path):
+    routes = {}  # path -> {method: handler}
+    with open(path) as f:
+        for lineno, line in enumerate(f, 1):
+            line = line.split("#", 1)[0].strip()
+            if not line:
+                continue
+            parts = line.split()
+            if len(parts) != 3:
+                sys.exit(f"{path}:{lineno}: expected 'method path handler'")
+            method, route, handler = parts
+            if method not in METHODS:
+                sys.exit(f"{path}:{lineno}: unsupported method {method}")
+            if not route.startswith("/"):
+                sys.exit(f"{path}:{lineno}: path must start with '/'")
+            if len(route) > 255:
+                sys.exit(f"{path}:{lineno}: path too long")
+            slot = routes.setdefault(route, {})
+            if method in slot:
+                sys.exit(f"{path}:{lineno}: duplicate {method} {route}")
+            slot[method] = handler
+    return routes
+
+
+def allow_head(methods):
+    allow = [m for m in METHODS if m in methods]
+    if "GET" in methods:
+        allow.insert(1, "HEAD")
+    return ("HTTP/1.1 405 Method Not Allowed\r\n"
+            f"Allow: {', '.join(allow)}\r\n"
+            "Content-Length: 0\r\n")
+
+
+def route_init(path, prefix, methods):
+    handlers = ", ".join(methods.get(m, "NULL") for m in METHODS)
+    match = path[:-1] if prefix else path
+    head = allow_head(methods)
+    return (f"\t{{{c_str(match)}, {len(match)}, {int(prefix)}, {{{handlers}}},\n"
+            f"\t\t(const uint8_t*){c_str(head)}, {len(head)}}},")
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(__doc__)
+
+    routes = parse(sys.argv[1])
+    exact = sorted(p for p in routes if not p.endswith("*"))
+    prefix = sorted((p for p in routes if p.endswith("*")), key=lambda p: -len(p))
+
+    if not exact:
+        sys.exit(f"{sys.argv[1]}: needs at least one exact path")
+    if len(exact) >= 0xFF:
+        sys.exit(f"{sys.argv[1]}: too many routes")
+    seed, size, slots = perfect_hash([p.encode() for p in exact])
+
+    handlers = sorted({h for m in routes.values() for h in m.values()})
+
+    out = []
+    out.append(f"// Generated by tools/gen_routes.py from {sys.argv[1]} - do not edit")
+    out.append('#include "memutils.h"')
+    out.append('#include "modules/http_routes.h"')
+    out.append("")
+    for h in handlers:
+        out.append(f"int {h}(const http_req_t* req, const uint8_t* buf, http_resp_t* resp);")
+    out.append("")
+    out.append(f"#define ROUTE_SLOTS {size}u")
+    out.append("")
+    out.append(f"static const http_route_t exact_routes[{len(exact)}] = {{")
+    for p in exact:
+        out.append(route_init(p, False, routes[p]))
+    out.append("};")
+    out.append("")
+    out.append("// slot -> index into exact_routes, 0xFF = empty")
+    out.append(f"static const uint8_t route_slots[ROUTE_SLOTS] = {{{c_slots(slots, size)}}};")
+    out.append("")
+    out.append(f"#define PREFIX_COUNT {len(prefix)}u")
+    if prefix:
+        out.append("")
+        out.append("// longest first")
+        out.append("static const http_route_t prefix_routes[PREFIX_COUNT] = {")
+        for p in prefix:
+            out.append(route_init(p, True, routes[p]))
+        out.append("};")
+    out.append("")
+    out.append(C_HASH.format(name="route_hash", seed=seed))
+    out.append("""
+const http_route_t* http_route_find(const uint8_t* path, uint16_t len) {
+	uint8_t idx = route_slots[route_hash(path, len) & (ROUTE_SLOTS - 1u)];
+	if (idx != 0xFF) {
+		const http_route_t* r = &exact_routes[idx];
+		if (r->path_len == len && mem_cmp(r->path, path, len) == 0)
+			return r;
+	}
+""")
+    if prefix:
+        out.append("""	for (uint8_t i = 0; i < PREFIX_COUNT; i++) {
+		const http_route_t* r = &prefix_routes[i];
+		if (r->path_len <= len && mem_cmp(r->path, path, r->path_len) == 0)
+			return r;
+	}
+""")
+    out.append("\treturn NULL;\n}")
+
+    with open(sys.argv[2], "w") as f:
+        f.write("\n".join(out) + "\n")
+
+
+if __name__ == "__main__":
+    main()
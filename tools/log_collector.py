@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+"""Receive the firmware log datagrams (LOGGER_UDP) and print them.
+
+usage: log_collector.py [--port N] [--bind ADDR] [<firmware.elf>]
+
+Each datagram is a sequence number (LE16) followed by whole records of the UART log stream:
+text lines and token frames (see log_decode.py). With the ELF, token frames are decoded;
+without it the raw stream goes to stdout, e.g. for `| log_decode.py firmware.elf`. Gaps in
+the sequence (batches the board dropped, or lost on the network) are reported on stderr.
+NET_LOG_DEST_IP / NET_LOG_DEST_PORT in include/modules/net.h must point at this host.
+"""
+
+import argparse
+import io
+import socket
+import sys
+
+import log_decode
+
+DGRAM_HDR = 2
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Receive the firmware log datagrams.")
+    ap.add_argument("elf", nargs="?", help="firmware ELF for the token formats")
+    ap.add_argument("--port", type=int, default=5140, help="UDP port (NET_LOG_DEST_PORT)")
+    ap.add_argument("--bind", default="0.0.0.0", help="local address to listen on")
+    args = ap.parse_args()
+
+    table = log_decode.logstr_section(args.elf) if args.elf else None
+
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.bind((args.bind, args.port))
+
+    expect = None
+    lost = 0
+
+    while True:
+        data, peer = sock.recvfrom(65535)
+        if len(data) < DGRAM_HDR:
+            continue
+
+        seq = data[0] | (data[1] << 8)
+        if expect is not None and seq == 0 and expect != 0:
+            print(f"--- {peer[0]}: restarted ---", file=sys.stderr)
+        elif expect is not None and seq != expect:
+            gap = (seq - expect) & 0xFFFF
+            lost += gap
+            print(f"--- {peer[0]}: {gap} datagram(s) lost, {lost} total ---", file=sys.stderr)
+        expect = (seq + 1) & 0xFFFF
+
+        payload = data[DGRAM_HDR:]
+        if table is None:
+            sys.stdout.buffer.write(payload)
+            sys.stdout.buffer.flush()
+        else:
+            # datagrams hold whole records, each one decodes on its own
+            log_decode.decode(table, io.BytesIO(payload), sys.stdout)
+
+
+if __name__ == "__main__":
+    try:
+        main()
+    except KeyboardInterrupt:
+        pass
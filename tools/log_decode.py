@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+"""Decode the firmware UART log: text lines pass through, tokenized records are formatted.
+
+usage: log_decode.py <firmware.elf> [<log file or serial device>]   (default: stdin)
+
+A token record (LOG_TOKENn in logger.h) is a binary frame between the text lines:
+0xFF, nargs, id (LE16), nargs LE32 words. The id is the offset of the format string in the
+.logstr section of the same ELF, so the ELF has to match the running firmware. A serial
+device is read as a file: set it up first, e.g. `stty -F /dev/ttyACM0 1000000 raw`.
+"""
+
+import re
+import struct
+import sys
+
+FRAME_MARK = 0xFF
+
+# printf conversions the firmware formats take: %[flags][width](u|d|i|x|X|c)
+CONV = re.compile(r"%([-+ 0#]*)(\d*)([udixXc%])")
+
+
+def logstr_section(path):
+    with open(path, "rb") as f:
+        elf = f.read()
+
+    if elf[:4] != b"\x7fELF":
+        sys.exit(f"{path}: not an ELF file")
+    is64 = elf[4] == 2
+    end = "<" if elf[5] == 1 else ">"
+
+    if is64:
+        shoff, = struct.unpack_from(end + "Q", elf, 0x28)
+        shentsize, shnum, shstrndx = struct.unpack_from(end + "HHH", elf, 0x3A)
+    else:
+        shoff, = struct.unpack_from(end + "I", elf, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from(end + "HHH", elf, 0x2E)
+
+    def section(i):
+        base = shoff + i * shentsize
+        if is64:
+            name, _, _, addr, off, size = struct.unpack_from(end + "IIQQQQ", elf, base)
+        else:
+            name, _, _, addr, off, size = struct.unpack_from(end + "IIIIII", elf, base)
+        return name, addr, off, size
+
+    _, _, str_off, _ = section(shstrndx)
+    for i in range(shnum):
+        name, addr, off, size = section(i)
+        name_end = elf.index(b"\0", str_off + name)
+        if elf[str_off + name:name_end] == b".logstr":
+            if addr != 0:
+                sys.exit(f"{path}: .logstr is not linked at 0")
+            return elf[off:off + size]
+
+    sys.exit(f"{path}: no .logstr section")
+
+
+def fmt_at(table, ident):
+    if ident >= len(table):
+        return None
+    return table[ident:table.index(b"\0", ident)].decode(errors="replace")
+
+
+def signed(v):
+    return v - (1 << 32) if v & 0x80000000 else v
+
+
+def render(fmt, args):
+    args = list(args)
+
+    def conv(m):
+        flags, width, kind = m.groups()
+        if kind == "%":
+            return "%"
+        v = args.pop(0) if args else 0
+        if kind in "di":
+            v, kind = signed(v), "d"
+        elif kind == "u":
+            kind = "d"
+        elif kind == "c":
+            v = chr(v & 0xFF)
+        return f"%{flags}{width}{kind}" % v
+
+    return CONV.sub(conv, fmt)
+
+
+def decode(table, stream, out):
+    line = bytearray()
+
+    while True:
+        b = stream.read(1)
+        if not b:
+            break
+
+        if b[0] != FRAME_MARK:
+            line += b
+            if b == b"\n":
+                out.write(line.decode(errors="replace"))
+                out.flush()
+                line.clear()
+            continue
+
+        hdr = stream.read(3)
+        if len(hdr) < 3:
+            break
+        nargs = hdr[0]
+        ident = hdr[1] | (hdr[2] << 8)
+        raw = stream.read(4 * nargs)
+        if len(raw) < 4 * nargs:
+            break
+        args = struct.unpack(f"<{nargs}I", raw)
+
+        fmt = fmt_at(table, ident)
+        if fmt is None:
+            text = f"<unknown token {ident:#06x} {' '.join(f'{a:#x}' for a in args)}>"
+        else:
+            text = render(fmt, args)
+        out.write(text + "\r\n")
+        out.flush()
+
+    if line:
+        out.write(line.decode(errors="replace"))
+
+
+def main():
+    if len(sys.argv) not in (2, 3):
+        sys.exit(__doc__)
+
+    table = logstr_section(sys.argv[1])
+
+    if len(sys.argv) == 3:
+        with open(sys.argv[2], "rb", buffering=0) as stream:
+            decode(table, stream, sys.stdout)
+    else:
+        decode(table, sys.stdin.buffer, sys.stdout)
+
+
+if __name__ == "__main__":
+    try:
+        main()
+    except KeyboardInterrupt:
+        pass
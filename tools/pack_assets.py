@@ -0,0 +1,179 @@
+#!/usr/bin/env python3
+"""Pack a directory of static files into const C tables served straight from flash.
+
+usage: pack_assets.py <web dir> <out.c>
+
+Every file gets its complete response head (status line, Content-Type, Content-Length, ETag,
+...) without the Connection line and the blank line, which net.c appends, plus the 304 head
+sent instead when If-None-Match already names that ETag. ETags are strong: a hash of the bytes
+that go out, so they change with the content and only then. A gzip body is added next to the
+identity body when it is smaller, with its own ETag over the gzip bytes. Paths are looked up
+through a perfect hash, like the route table. dir/index.html is also reachable as dir/.
+"""
+
+import gzip
+import hashlib
+import os
+import sys
+
+from phash import C_HASH, c_bytes, c_slots, c_str, perfect_hash
+
+CONTENT_TYPES = {
+    ".html": "text/html; charset=utf-8",
+    ".css": "text/css; charset=utf-8",
+    ".js": "text/javascript; charset=utf-8",
+    ".json": "application/json",
+    ".svg": "image/svg+xml",
+    ".png": "image/png",
+    ".ico": "image/x-icon",
+    ".txt": "text/plain; charset=utf-8",
+}
+
+# already compressed, gzip would only cost CPU on the client
+NO_GZIP = {".png", ".ico"}
+
+
+def head(ctype, length, etag, gz, vary):
+    lines = ["HTTP/1.1 200 OK", f"Content-Type: {ctype}", f"Content-Length: {length}"]
+    if gz:
+        lines.append("Content-Encoding: gzip")
+    return lines + validators(etag, vary)
+
+
+def validators(etag, vary):
+    # shared by 200 and 304, a 304 has to repeat them
+    lines = []
+    if vary:
+        lines.append("Vary: Accept-Encoding")
+    lines.append(f"ETag: {etag}")
+    lines.append("Cache-Control: no-cache")  # always revalidate, the ETag makes that cheap
+    return lines
+
+
+def strong_etag(body):
+    return '"' + hashlib.sha1(body).hexdigest()[:16] + '"'
+
+
+def crlf(lines):
+    return "".join(line + "\r\n" for line in lines)
+
+
+def rep(out, name, ctype, body, etag, gz, vary):
+    """Emit one representation, return its asset_rep_t initializer."""
+    out.append(f"static const uint8_t {name}_head[] = "
+               f"{c_str(crlf(head(ctype, len(body), etag, gz, vary)))};")
+    out.append(f"static const uint8_t {name}_304[] = "
+               f"{c_str(crlf(['HTTP/1.1 304 Not Modified'] + validators(etag, vary)))};")
+    out.append(f"static const uint8_t {name}_body[] = {{")
+    out.append(c_bytes(body or b"\0"))
+    out.append("};")
+    return (f"{{{name}_head, sizeof({name}_head) - 1, {name}_body, {len(body)}u,\n"
+            f"\t\t{name}_304, sizeof({name}_304) - 1, {c_str(etag)}, {len(etag)}}}")
+
+
+def collect(root):
+    files = []
+    for dirpath, dirnames, filenames in os.walk(root):
+        dirnames.sort()
+        for name in sorted(filenames):
+            if name.startswith("."):
+                continue
+            full = os.path.join(dirpath, name)
+            rel = "/" + os.path.relpath(full, root).replace(os.sep, "/")
+            files.append((rel, full))
+    return files
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(__doc__)
+
+    root = sys.argv[1]
+    files = collect(root)
+    if not files:
+        sys.exit(f"{root}: no assets")
+
+    out = []
+    out.append(f"// Generated by tools/pack_assets.py from {root}/ - do not edit")
+    out.append('#include "memutils.h"')
+    out.append('#include "modules/assets.h"')
+    out.append("")
+
+    keys = []  # (path, asset index)
+    entries = []
+
+    for n, (path, full) in enumerate(files):
+        ext = os.path.splitext(path)[1].lower()
+        ctype = CONTENT_TYPES.get(ext, "application/octet-stream")
+
+        with open(full, "rb") as f:
+            data = f.read()
+        if len(data) > 0xFFFFFFFF:
+            sys.exit(f"{full}: too large")
+
+        gz = None
+        if ext not in NO_GZIP:
+            packed = gzip.compress(data, compresslevel=9, mtime=0)
+            if len(packed) < len(data):
+                gz = packed
+
+        out.append(f"// {path}")
+        rep_id = rep(out, f"a{n}", ctype, data, strong_etag(data), False, gz is not None)
+
+        rep_gz = "{NULL, 0, NULL, 0, NULL, 0, NULL, 0}"
+        if gz is not None:
+            # a different representation needs its own strong ETag, over its own bytes
+            rep_gz = rep(out, f"a{n}_gz", ctype, gz, strong_etag(gz), True, True)
+        out.append("")
+
+        entries.append(f"\t// {path}\n\t{{{rep_id},\n\t\t{rep_gz}}},")
+
+        keys.append((path, n))
+        if path.endswith("/index.html"):
+            keys.append((path[: -len("index.html")], n))
+
+    if len(keys) >= 0xFF:
+        sys.exit(f"{root}: too many assets")
+    for path, _ in keys:
+        if len(path) > 255:
+            sys.exit(f"{path}: path too long")
+
+    seed, size, slots = perfect_hash([p.encode() for p, _ in keys])
+
+    out.append(f"static const asset_t assets[{len(files)}] = {{")
+    out.extend(entries)
+    out.append("};")
+    out.append("")
+    out.append("static const struct {")
+    out.append("\tconst char* path;")
+    out.append("\tuint8_t path_len;")
+    out.append("\tuint8_t asset;")
+    out.append(f"}} asset_keys[{len(keys)}] = {{")
+    for path, n in keys:
+        out.append(f"\t{{{c_str(path)}, {len(path)}, {n}}},")
+    out.append("};")
+    out.append("")
+    out.append(f"#define ASSET_SLOTS {size}u")
+    out.append("")
+    out.append("// slot -> index into asset_keys, 0xFF = empty")
+    out.append(f"static const uint8_t asset_slots[ASSET_SLOTS] = {{{c_slots(slots, size)}}};")
+    out.append("")
+    out.append(C_HASH.format(name="asset_hash", seed=seed))
+    out.append("""
+const asset_t* assets_find(const uint8_t* path, uint16_t len) {
+	uint8_t idx = asset_slots[asset_hash(path, len) & (ASSET_SLOTS - 1u)];
+	if (idx == 0xFF)
+		return NULL;
+
+	if (asset_keys[idx].path_len != len || mem_cmp(asset_keys[idx].path, path, len) != 0)
+		return NULL;
+
+	return &assets[asset_keys[idx].asset];
+}""")
+
+    with open(sys.argv[2], "w") as f:
+        f.write("\n".join(out) + "\n")
+
+
+if __name__ == "__main__":
+    main()
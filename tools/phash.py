@@ -0,0 +1,60 @@
+"""Perfect hashing and C emit helpers shared by the generators in tools/."""
+
+# seeds tried per table size before the table doubles: a size where a collision-free seed is
+# rare (one in millions for 16 keys in 16 slots) is given up quickly instead of searched through
+SEEDS_PER_SIZE = 1 << 14
+
+# runtime side of fnv1a(), emitted into each generated file with its own name and seed
+C_HASH = """static uint32_t {name}(const uint8_t* key, uint16_t len) {{
+	uint32_t h = 2166136261u ^ {seed}u;
+	for (uint16_t i = 0; i < len; i++) {{
+		h ^= key[i];
+		h *= 16777619u;
+	}}
+	return h;
+}}"""
+
+
+def fnv1a(seed, data):
+    h = (2166136261 ^ seed) & 0xFFFFFFFF
+    for b in data:
+        h ^= b
+        h = (h * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def perfect_hash(keys):
+    """Returns (seed, size, slots): every key in its own slot of a power-of-two table.
+
+    slots maps slot index -> position of the key in keys.
+    """
+    size = 1
+    while size < len(keys):
+        size <<= 1
+    while True:
+        for seed in range(SEEDS_PER_SIZE):
+            slots = {}
+            for n, k in enumerate(keys):
+                i = fnv1a(seed, k) & (size - 1)
+                if i in slots:
+                    break
+                slots[i] = n
+            else:
+                return seed, size, slots
+        size <<= 1
+
+
+def c_str(s):
+    s = s.replace("\\", "\\\\").replace('"', '\\"')
+    return '"' + s.replace("\r", "\\r").replace("\n", "\\n") + '"'
+
+
+def c_bytes(data, indent="\t", per_line=16):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append(indent + ", ".join(f"0x{b:02x}" for b in data[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def c_slots(slots, size):
+    return ", ".join(str(slots[i]) if i in slots else "0xFF" for i in range(size))
@@ -0,0 +1,12 @@
+"use strict";
+
+(async () => {
+	const el = document.getElementById("status");
+	try {
+		const res = await fetch("/health", { cache: "no-store" });
+		const body = await res.json();
+		el.textContent = body.status;
+	} catch (err) {
+		el.textContent = "unreachable";
+	}
+})();